@@ -45,7 +45,10 @@ namespace xt
         using temporary_type = typename base_type::temporary_type;
 
         template <class E>
-        derived_type& assign_xexpression(const xexpression<E>& e);
+        derived_type& assign_xexpression(
+            const xexpression<E>& e,
+            const execution_policy& policy = execution::default_policy
+        );
 
         template <class E>
         derived_type& computed_assign(const xexpression<E>& e);
@@ -202,7 +205,8 @@ namespace xt
 
     template <class D>
     template <class E>
-    inline auto xchunked_semantic<D>::assign_xexpression(const xexpression<E>& e) -> derived_type&
+    inline auto xchunked_semantic<D>::assign_xexpression(const xexpression<E>& e, const execution_policy& policy)
+        -> derived_type&
     {
         auto& d = this->derived_cast();
         const auto& chunk_shape = d.chunk_shape();
@@ -213,11 +217,11 @@ namespace xt
             auto rhs = strided_view(e.derived_cast(), it.get_slice_vector());
             if (rhs.shape() != chunk_shape)
             {
-                noalias(strided_view(*it, it.get_chunk_slice_vector())) = rhs;
+                noalias(strided_view(*it, it.get_chunk_slice_vector())).assign(rhs, policy);
             }
             else
             {
-                noalias(*it) = rhs;
+                noalias(*it).assign(rhs, policy);
             }
         }
 
@@ -18,6 +18,7 @@
 #include <memory>
 #include <type_traits>
 
+#include "../core/xexecution.hpp"
 #include "../core/xtensor_config.hpp"
 #include "../utils/xexception.hpp"
 #include "../utils/xtensor_simd.hpp"
@@ -159,14 +160,38 @@ namespace xt
 
     namespace detail
     {
+        /**
+         * Allocates a buffer and, if it is larger than XTENSOR_FIRST_TOUCH_THRESHOLD,
+         * touches its pages in parallel so that they are spread over the NUMA nodes
+         * the same way as the parallel assignments to the buffer.
+         */
         template <class A>
         inline typename std::allocator_traits<A>::pointer
-        safe_init_allocate(A& alloc, typename std::allocator_traits<A>::size_type size)
+        first_touch_allocate(A& alloc, typename std::allocator_traits<A>::size_type size)
         {
             using traits = std::allocator_traits<A>;
             using pointer = typename traits::pointer;
             using value_type = typename traits::value_type;
             pointer res = alloc.allocate(size);
+            if constexpr (std::is_trivially_copyable<value_type>::value)
+            {
+                constexpr std::size_t threshold = XTENSOR_FIRST_TOUCH_THRESHOLD;
+                if (threshold != 0 && size * sizeof(value_type) >= threshold)
+                {
+                    first_touch(std::to_address(res), static_cast<std::size_t>(size));
+                }
+            }
+            return res;
+        }
+
+        template <class A>
+        inline typename std::allocator_traits<A>::pointer
+        safe_init_allocate(A& alloc, typename std::allocator_traits<A>::size_type size)
+        {
+            using traits = std::allocator_traits<A>;
+            using pointer = typename traits::pointer;
+            using value_type = typename traits::value_type;
+            pointer res = first_touch_allocate(alloc, size);
             if (!xtrivially_default_constructible<value_type>::value)
             {
                 for (pointer p = res; p != res + size; ++p)
@@ -208,7 +233,7 @@ namespace xt
         size_type size = static_cast<size_type>(std::distance(first, last));
         if (size != size_type(0))
         {
-            p_begin = m_allocator.allocate(size);
+            p_begin = detail::first_touch_allocate(m_allocator, size);
             std::uninitialized_copy(first, last, p_begin);
             p_end = p_begin + size;
         }
@@ -262,7 +287,7 @@ namespace xt
     {
         if (count != 0)
         {
-            p_begin = m_allocator.allocate(count);
+            p_begin = detail::first_touch_allocate(m_allocator, count);
             p_end = p_begin + count;
             std::uninitialized_fill(p_begin, p_end, value);
         }
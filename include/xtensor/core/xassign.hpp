@@ -11,13 +11,17 @@
 #define XTENSOR_ASSIGN_HPP
 
 #include <algorithm>
+#include <chrono>
+#include <cstdlib>
 #include <functional>
 #include <type_traits>
+#include <tuple>
 #include <utility>
 
 #include <xtl/xcomplex.hpp>
 #include <xtl/xsequence.hpp>
 
+#include "../core/xexecution.hpp"
 #include "../core/xexpression.hpp"
 #include "../core/xfunction.hpp"
 #include "../core/xiterator.hpp"
@@ -26,10 +30,6 @@
 #include "../core/xtensor_forward.hpp"
 #include "../utils/xutils.hpp"
 
-#if defined(XTENSOR_USE_TBB)
-#include <tbb/tbb.h>
-#endif
-
 namespace xt
 {
 
@@ -38,10 +38,19 @@ namespace xt
      ********************/
 
     template <class E1, class E2>
-    void assign_data(xexpression<E1>& e1, const xexpression<E2>& e2, bool trivial);
+    void assign_data(
+        xexpression<E1>& e1,
+        const xexpression<E2>& e2,
+        bool trivial,
+        const execution_policy& policy = execution::default_policy
+    );
 
     template <class E1, class E2>
-    void assign_xexpression(xexpression<E1>& e1, const xexpression<E2>& e2);
+    void assign_xexpression(
+        xexpression<E1>& e1,
+        const xexpression<E2>& e2,
+        const execution_policy& policy = execution::default_policy
+    );
 
     template <class E1, class E2>
     void computed_assign(xexpression<E1>& e1, const xexpression<E2>& e2);
@@ -52,12 +61,63 @@ namespace xt
     template <class E1, class E2>
     void assert_compatible_shape(const xexpression<E1>& e1, const xexpression<E2>& e2);
 
+    template <class... E1, class... E2>
+    void assign_all(std::tuple<E1&...> e1, const xexpression<E2>&... e2);
+
+    template <class... E1, class... E2>
+    void assign_all(std::tuple<E1&...> e1, const execution_policy& policy, const xexpression<E2>&... e2);
+
     template <class E1, class E2>
     void strided_assign(E1& e1, const E2& e2, std::false_type /*disable*/);
 
     template <class E1, class E2>
     void strided_assign(E1& e1, const E2& e2, std::true_type /*enable*/);
 
+    /*********************
+     * Assignment traces *
+     *********************/
+
+    /**
+     * Loops used to assign an expression.
+     */
+    enum class assign_path
+    {
+        /// Single loop over the buffers of contiguous expressions with the same layout.
+        linear,
+        /// Loop over square tiles, for expressions whose unit-stride dimensions differ.
+        tiled,
+        /// Inner loop over the unit-stride dimensions nested in an outer loop.
+        strided_loop,
+        /// Multi-dimensional index stepping, used when no other loop applies.
+        stepper
+    };
+
+    /**
+     * Description of an assignment, reported to the callback registered with
+     * set_assign_trace_callback when ``XTENSOR_ENABLE_ASSIGN_TRACE`` is defined.
+     */
+    struct assign_trace
+    {
+        assign_path path;
+        /// True if the loop evaluates the expression with SIMD batches.
+        bool simd;
+        /// True if the loop is split across several threads.
+        bool parallel;
+        /// Number of elements of the assigned expression.
+        std::size_t size;
+        std::size_t dimension;
+        /// Sizes of the inner and outer loops of a strided loop assignment, size
+        /// and number of the tiles of a tiled assignment, 0 for the other paths.
+        std::size_t inner_loop_size;
+        std::size_t outer_loop_size;
+        std::chrono::nanoseconds duration;
+    };
+
+    using assign_trace_callback = std::function<void(const assign_trace&)>;
+
+    assign_trace_callback set_assign_trace_callback(assign_trace_callback callback);
+    const assign_trace_callback& get_assign_trace_callback() noexcept;
+
     /************************
      * xexpression_assigner *
      ************************/
@@ -71,7 +131,12 @@ namespace xt
     public:
 
         template <class E1, class E2>
-        static void assign_data(xexpression<E1>& e1, const xexpression<E2>& e2, bool trivial);
+        static void assign_data(
+            xexpression<E1>& e1,
+            const xexpression<E2>& e2,
+            bool trivial,
+            const execution_policy& policy = execution::default_policy
+        );
     };
 
     template <class Tag>
@@ -82,7 +147,8 @@ namespace xt
         using base_type = xexpression_assigner_base<Tag>;
 
         template <class E1, class E2>
-        static void assign_xexpression(E1& e1, const E2& e2);
+        static void
+        assign_xexpression(E1& e1, const E2& e2, const execution_policy& policy = execution::default_policy);
 
         template <class E1, class E2>
         static void computed_assign(xexpression<E1>& e1, const xexpression<E2>& e2);
@@ -93,8 +159,7 @@ namespace xt
         template <class E1, class E2>
         static void assert_compatible_shape(const xexpression<E1>& e1, const xexpression<E2>& e2);
 
-    private:
-
+        // Resizes e1 to the shape of e2, returns true if the broadcasting is trivial
         template <class E1, class E2>
         static bool resize(E1& e1, const E2& e2);
 
@@ -120,7 +185,7 @@ namespace xt
 
         stepper_assigner(E1& e1, const E2& e2);
 
-        void run();
+        void run(const execution_policy& policy = execution::default_policy);
 
         void step(size_type i);
         void step(size_type i, size_type n);
@@ -130,7 +195,11 @@ namespace xt
 
     private:
 
+        void to_element(size_type n);
+        void assign_elements(size_type n);
+
         E1& m_e1;
+        const E2& m_e2;
 
         lhs_iterator m_lhs;
         rhs_iterator m_rhs;
@@ -148,7 +217,7 @@ namespace xt
     public:
 
         template <class E1, class E2>
-        static void run(E1& e1, const E2& e2);
+        static void run(E1& e1, const E2& e2, const execution_policy& policy = execution::default_policy);
     };
 
     template <>
@@ -157,15 +226,15 @@ namespace xt
     public:
 
         template <class E1, class E2>
-        static void run(E1& e1, const E2& e2);
+        static void run(E1& e1, const E2& e2, const execution_policy& policy = execution::default_policy);
 
     private:
 
         template <class E1, class E2>
-        static void run_impl(E1& e1, const E2& e2, std::true_type);
+        static void run_impl(E1& e1, const E2& e2, const execution_policy& policy, std::true_type);
 
         template <class E1, class E2>
-        static void run_impl(E1& e1, const E2& e2, std::false_type);
+        static void run_impl(E1& e1, const E2& e2, const execution_policy& policy, std::false_type);
     };
 
     /*************************
@@ -193,11 +262,69 @@ namespace xt
         using loop_sizes_t = strided_assign_detail::loop_sizes_t;
         // is_row_major, inner_loop_size, outer_loop_size, cut
         template <class E1, class E2>
-        static void run(E1& e1, const E2& e2, const loop_sizes_t& loop_sizes);
+        static void run(
+            E1& e1,
+            const E2& e2,
+            const loop_sizes_t& loop_sizes,
+            const execution_policy& policy = execution::default_policy
+        );
         template <class E1, class E2>
         static loop_sizes_t get_loop_sizes(E1& e1, const E2& e2);
         template <class E1, class E2>
-        static void run(E1& e1, const E2& e2);
+        static void run(E1& e1, const E2& e2, const execution_policy& policy = execution::default_policy);
+    };
+
+    /******************
+     * tiled_assigner *
+     ******************/
+
+    namespace tiled_assign_detail
+    {
+        struct tile_loop_t
+        {
+            bool can_do_tiled_assign;
+            // dimension along which the destination has a unit stride
+            std::size_t write_dim;
+            // dimension along which the source has a unit stride
+            std::size_t read_dim;
+            std::size_t tile_size;
+            std::size_t nb_tiles;
+            std::size_t nb_write_tiles;
+            std::size_t nb_read_tiles;
+            // other dimensions, by decreasing destination stride
+            dynamic_shape<std::size_t> outer_shape;
+            dynamic_shape<std::ptrdiff_t> outer_strides1;
+            dynamic_shape<std::ptrdiff_t> outer_strides2;
+        };
+
+        template <class T1, class T2>
+        constexpr std::size_t tile_size();
+    }
+
+    /**
+     * Assigns a strided source whose unit-stride dimension differs from the
+     * one of the destination, e.g. a transposed matrix, tile by tile. Every
+     * tile reads a few cache lines of the source along its unit-stride
+     * dimension while writing contiguous runs of the destination, instead of
+     * reading one element per cache line.
+     */
+    template <bool tiled>
+    class tiled_assigner
+    {
+    public:
+
+        using tile_loop_t = tiled_assign_detail::tile_loop_t;
+
+        template <class E1, class E2>
+        static tile_loop_t get_tile_loop(const E1& e1, const E2& e2);
+
+        template <class E1, class E2>
+        static void run(
+            E1& e1,
+            const E2& e2,
+            const tile_loop_t& loop,
+            const execution_policy& policy = execution::default_policy
+        );
     };
 
     /***********************************
@@ -205,14 +332,16 @@ namespace xt
      ***********************************/
 
     template <class E1, class E2>
-    inline void assign_data(xexpression<E1>& e1, const xexpression<E2>& e2, bool trivial)
+    inline void
+    assign_data(xexpression<E1>& e1, const xexpression<E2>& e2, bool trivial, const execution_policy& policy)
     {
         using tag = xexpression_tag_t<E1, E2>;
-        xexpression_assigner<tag>::assign_data(e1, e2, trivial);
+        xexpression_assigner<tag>::assign_data(e1, e2, trivial, policy);
     }
 
     template <class E1, class E2>
-    inline void assign_xexpression(xexpression<E1>& e1, const xexpression<E2>& e2)
+    inline void
+    assign_xexpression(xexpression<E1>& e1, const xexpression<E2>& e2, const execution_policy& policy)
     {
         if constexpr (has_assign_to<E1, E2>::value)
         {
@@ -221,7 +350,7 @@ namespace xt
         else
         {
             using tag = xexpression_tag_t<E1, E2>;
-            xexpression_assigner<tag>::assign_xexpression(e1, e2);
+            xexpression_assigner<tag>::assign_xexpression(e1, e2, policy);
         }
     }
 
@@ -296,6 +425,23 @@ namespace xt
         {
         };
 
+        // True if the elements of E can be addressed through a pointer, its
+        // data offset and its strides; some expressions with a data interface
+        // wrap iterators instead of a buffer.
+        template <class E, class = void>
+        struct has_buffer_interface : std::false_type
+        {
+        };
+
+        template <class E>
+        using storage_data_t = decltype(std::declval<const E&>().storage().data());
+
+        template <class E>
+        struct has_buffer_interface<E, void_t<storage_data_t<E>, decltype(std::declval<const E&>().strides())>>
+            : std::conjunction<has_data_interface<E>, std::is_pointer<storage_data_t<E>>>
+        {
+        };
+
         template <class T>
         struct use_strided_loop
         {
@@ -421,6 +567,12 @@ namespace xt
             return contiguous_layout() && simd_assign();
         }
 
+        static constexpr bool tiled_assign()
+        {
+            return detail::has_buffer_interface<E1>::value && detail::has_buffer_interface<E2>::value
+                   && convertible_types();
+        }
+
         static constexpr bool simd_strided_assign()
         {
             return strided_assign() && simd_assign();
@@ -436,11 +588,125 @@ namespace xt
         using requested_value_type = detail::conditional_promote_to_complex_t<e1_value_type, e2_requested_value_type>;
     };
 
+    /************************************
+     * Assignment traces implementation *
+     ************************************/
+
+    namespace detail
+    {
+        inline assign_trace_callback& assign_trace_callback_instance()
+        {
+            static assign_trace_callback callback;
+            return callback;
+        }
+
+#if defined(XTENSOR_ENABLE_ASSIGN_TRACE)
+        // Times an assignment and reports it to the registered callback, if any
+        class assign_tracer
+        {
+        public:
+
+            assign_tracer(std::size_t size, std::size_t dimension)
+                : p_callback(assign_trace_callback_instance() ? &assign_trace_callback_instance() : nullptr)
+                , m_trace{assign_path::stepper, false, false, size, dimension, 0, 0, {}}
+            {
+                if (p_callback != nullptr)
+                {
+                    m_start = std::chrono::steady_clock::now();
+                }
+            }
+
+            template <class F>
+            void
+            record(assign_path path, bool simd, F&& is_parallel, std::size_t inner = 0, std::size_t outer = 0)
+            {
+                if (p_callback != nullptr)
+                {
+                    m_trace.path = path;
+                    m_trace.simd = simd;
+                    m_trace.parallel = is_parallel();
+                    m_trace.inner_loop_size = inner;
+                    m_trace.outer_loop_size = outer;
+                }
+            }
+
+            void report()
+            {
+                if (p_callback != nullptr)
+                {
+                    m_trace.duration = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now() - m_start
+                    );
+                    (*p_callback)(m_trace);
+                }
+            }
+
+        private:
+
+            const assign_trace_callback* p_callback;
+            assign_trace m_trace;
+            std::chrono::steady_clock::time_point m_start;
+        };
+#else
+        class assign_tracer
+        {
+        public:
+
+            assign_tracer(std::size_t, std::size_t) noexcept
+            {
+            }
+
+            template <class F>
+            void record(assign_path, bool, F&&, std::size_t = 0, std::size_t = 0) noexcept
+            {
+            }
+
+            void report() noexcept
+            {
+            }
+        };
+#endif
+    }
+
+    /**
+     * Registers \p callback to be called after every assignment when
+     * ``XTENSOR_ENABLE_ASSIGN_TRACE`` is defined, and returns the previous
+     * callback. An empty callback disables the reports. The callback is called
+     * on the thread doing the assignment; it must not be changed while
+     * assignments are running on other threads.
+     *
+     * @code{.cpp}
+     * xt::set_assign_trace_callback(
+     *     [](const xt::assign_trace& t)
+     *     {
+     *         if (t.path == xt::assign_path::stepper)
+     *         {
+     *             std::cerr << "slow assignment of " << t.size << " elements\n";
+     *         }
+     *     }
+     * );
+     * @endcode
+     */
+    inline assign_trace_callback set_assign_trace_callback(assign_trace_callback callback)
+    {
+        std::swap(detail::assign_trace_callback_instance(), callback);
+        return callback;
+    }
+
+    /**
+     * Returns the callback registered with set_assign_trace_callback.
+     */
+    inline const assign_trace_callback& get_assign_trace_callback() noexcept
+    {
+        return detail::assign_trace_callback_instance();
+    }
+
     template <class E1, class E2>
     inline void xexpression_assigner_base<xtensor_expression_tag>::assign_data(
         xexpression<E1>& e1,
         const xexpression<E2>& e2,
-        bool trivial
+        bool trivial,
+        const execution_policy& policy
     )
     {
         E1& de1 = e1.derived_cast();
@@ -451,6 +717,17 @@ namespace xt
         constexpr bool simd_assign = traits::simd_assign();
         constexpr bool simd_linear_assign = traits::simd_linear_assign();
         constexpr bool simd_strided_assign = traits::simd_strided_assign();
+        constexpr std::size_t cost = expression_cost<E2>::value + 1;
+        std::size_t size = static_cast<std::size_t>(de1.size());
+        auto is_parallel = [&policy, size](std::size_t c)
+        {
+            return [&policy, size, c]()
+            {
+                return policy.use_parallel(size, c);
+            };
+        };
+
+        detail::assign_tracer tracer(size, static_cast<std::size_t>(de1.dimension()));
         if (linear_assign)
         {
             if (simd_linear_assign || traits::simd_linear_assign(de1, de2))
@@ -460,29 +737,72 @@ namespace xt
                 // in compilation error for expressions that do not provide a SIMD interface.
                 // simd_assign is true if simd_linear_assign() or simd_linear_assign(de1, de2)
                 // is true.
-                linear_assigner<simd_assign>::run(de1, de2);
+                tracer.record(assign_path::linear, simd_assign, is_parallel(cost));
+                linear_assigner<simd_assign>::run(de1, de2, policy);
             }
             else
             {
-                linear_assigner<false>::run(de1, de2);
+                tracer.record(assign_path::linear, false, is_parallel(cost));
+                linear_assigner<false>::run(de1, de2, policy);
             }
         }
-        else if (simd_strided_assign)
-        {
-            strided_loop_assigner<simd_strided_assign>::run(de1, de2);
-        }
         else
         {
-            stepper_assigner<E1, E2, default_assignable_layout(E1::static_layout)>(de1, de2).run();
+            constexpr bool tiled_assign = traits::tiled_assign();
+            auto tile_loop = tiled_assigner<tiled_assign>::get_tile_loop(de1, de2);
+            strided_assign_detail::loop_sizes_t loop_sizes{};
+            if constexpr (simd_strided_assign)
+            {
+                if (!tile_loop.can_do_tiled_assign)
+                {
+                    loop_sizes = strided_loop_assigner<simd_strided_assign>::get_loop_sizes(de1, de2);
+                }
+            }
+
+            if (tile_loop.can_do_tiled_assign)
+            {
+                tracer.record(
+                    assign_path::tiled,
+                    false,
+                    is_parallel(cost),
+                    tile_loop.tile_size,
+                    tile_loop.nb_tiles
+                );
+                tiled_assigner<tiled_assign>::run(de1, de2, tile_loop, policy);
+            }
+            else if (loop_sizes.can_do_strided_assign)
+            {
+                tracer.record(
+                    assign_path::strided_loop,
+                    true,
+                    is_parallel(cost),
+                    loop_sizes.inner_loop_size,
+                    loop_sizes.outer_loop_size
+                );
+                strided_loop_assigner<simd_strided_assign>::run(de1, de2, loop_sizes, policy);
+            }
+            else
+            {
+                // Writes through an index view are never split across threads
+                std::size_t stepper_cost = 2 * element_cost(de2) + 2;
+                auto is_stepper_parallel = [&is_parallel, stepper_cost]()
+                {
+                    return has_data_interface<E1>::value && is_parallel(stepper_cost)();
+                };
+                tracer.record(assign_path::stepper, false, is_stepper_parallel);
+                stepper_assigner<E1, E2, default_assignable_layout(E1::static_layout)>(de1, de2).run(policy);
+            }
         }
+        tracer.report();
     }
 
     template <class Tag>
     template <class E1, class E2>
-    inline void xexpression_assigner<Tag>::assign_xexpression(E1& e1, const E2& e2)
+    inline void
+    xexpression_assigner<Tag>::assign_xexpression(E1& e1, const E2& e2, const execution_policy& policy)
     {
         bool trivial_broadcast = resize(e1.derived_cast(), e2.derived_cast());
-        base_type::assign_data(e1, e2, trivial_broadcast);
+        base_type::assign_data(e1, e2, trivial_broadcast, policy);
     }
 
     template <class Tag>
@@ -644,6 +964,7 @@ namespace xt
     template <class E1, class E2, layout_type L>
     inline stepper_assigner<E1, E2, L>::stepper_assigner(E1& e1, const E2& e2)
         : m_e1(e1)
+        , m_e2(e2)
         , m_lhs(e1.stepper_begin(e1.shape()))
         , m_rhs(e2.stepper_begin(e1.shape()))
         , m_index(xtl::make_sequence<index_type>(e1.shape().size(), size_type(0)))
@@ -651,15 +972,72 @@ namespace xt
     }
 
     template <class E1, class E2, layout_type L>
-    inline void stepper_assigner<E1, E2, L>::run()
+    inline void stepper_assigner<E1, E2, L>::run(const execution_policy& policy)
     {
         using tmp_size_type = typename E1::size_type;
+        // Stepping costs about as much as a load for each operand
+        std::size_t cost = 2 * element_cost(m_e2) + 2;
+        // Writes through strided data never overlap, unlike writes through
+        // an index view which may hold the same index several times.
+        constexpr bool parallel_lhs = has_data_interface<E1>::value;
+
+        tmp_size_type s = m_e1.size();
+        if (parallel_lhs && policy.use_parallel(s, cost))
+        {
+            // The steppers of this assigner have been built on the calling thread, so
+            // every lazily computed shape of the expressions is known before the
+            // workers build their own ones.
+            detail::parallel_for(
+                policy,
+                std::size_t(0),
+                static_cast<std::size_t>(s),
+                [this](std::size_t first, std::size_t last)
+                {
+                    stepper_assigner chunk(m_e1, m_e2);
+                    chunk.to_element(static_cast<size_type>(first));
+                    chunk.assign_elements(static_cast<size_type>(last - first));
+                },
+                policy.grain_size(cost)
+            );
+        }
+        else
+        {
+            assign_elements(s);
+        }
+    }
+
+    /**
+     * Positions the steppers on the n-th element in the traversal order,
+     * starting from the beginning of the expressions.
+     */
+    template <class E1, class E2, layout_type L>
+    inline void stepper_assigner<E1, E2, L>::to_element(size_type n)
+    {
+        const auto& shape = m_e1.shape();
+        const size_type dim = m_index.size();
+        for (size_type k = 0; k < dim; ++k)
+        {
+            size_type i = (L == layout_type::row_major) ? dim - 1 - k : k;
+            m_index[i] = n % shape[i];
+            n /= shape[i];
+        }
+        for (size_type i = 0; i < dim; ++i)
+        {
+            if (m_index[i] != 0)
+            {
+                step(i, m_index[i]);
+            }
+        }
+    }
+
+    template <class E1, class E2, layout_type L>
+    inline void stepper_assigner<E1, E2, L>::assign_elements(size_type n)
+    {
         using argument_type = std::decay_t<decltype(*m_rhs)>;
         using result_type = std::decay_t<decltype(*m_lhs)>;
         constexpr bool needs_cast = has_assign_conversion<argument_type, result_type>::value;
 
-        tmp_size_type s = m_e1.size();
-        for (tmp_size_type i = 0; i < s; ++i)
+        for (size_type i = 0; i < n; ++i)
         {
             *m_lhs = conditional_cast<needs_cast, result_type>(*m_rhs);
             stepper_tools<L>::increment_stepper(*this, m_index, m_e1.shape());
@@ -698,152 +1076,403 @@ namespace xt
      * linear_assigner implementation *
      **********************************/
 
-    template <bool simd_assign>
-    template <class E1, class E2>
-    inline void linear_assigner<simd_assign>::run(E1& e1, const E2& e2)
+    namespace detail
     {
-        using lhs_align_mode = xt_simd::container_alignment_t<E1>;
-        constexpr bool is_aligned = std::is_same<lhs_align_mode, aligned_mode>::value;
-        using rhs_align_mode = std::conditional_t<is_aligned, inner_aligned_mode, unaligned_mode>;
-        using e1_value_type = typename E1::value_type;
-        using e2_value_type = typename E2::value_type;
-        using value_type = typename xassign_traits<E1, E2>::requested_value_type;
-        using simd_type = xt_simd::simd_type<value_type>;
-        using size_type = typename E1::size_type;
-        size_type size = e1.size();
-        constexpr size_type simd_size = simd_type::size;
-        constexpr bool needs_cast = has_assign_conversion<e2_value_type, e1_value_type>::value;
-
-        size_type align_begin = is_aligned ? 0 : xt_simd::get_alignment_offset(e1.data(), size, simd_size);
-        size_type align_end = align_begin + ((size - align_begin) & ~(simd_size - 1));
-
-        for (size_type i = 0; i < align_begin; ++i)
-        {
-            e1.data_element(i) = conditional_cast<needs_cast, e1_value_type>(e2.data_element(i));
-        }
-
-#if defined(XTENSOR_USE_TBB)
-        if (size >= XTENSOR_TBB_THRESHOLD)
+        /**
+         * Linear assignment to the buffer of e1 with non-temporal stores, either
+         * batch by batch or element by element.
+         */
+        template <bool simd>
+        struct streaming_assigner
         {
-            tbb::static_partitioner ap;
-            tbb::parallel_for(
-                align_begin,
-                align_end,
-                simd_size,
-                [&e1, &e2](size_t i)
+            // The requested value type of a SIMD assignment must be the value
+            // type of E1, so that batches are stored without conversion.
+            template <class E1, class E2>
+            static constexpr bool available()
+            {
+                using value_type = typename E1::value_type;
+                if constexpr (simd)
                 {
-                    e1.template store_simd<lhs_align_mode>(
-                        i,
-                        e2.template load_simd<rhs_align_mode, value_type>(i)
-                    );
-                },
-                ap
-            );
-        }
-        else
+                    using requested_type = typename xassign_traits<E1, E2>::requested_value_type;
+                    return has_buffer_interface<E1>::value && std::is_same<requested_type, value_type>::value
+                           && xt_simd::has_stream_store<xt_simd::simd_type<value_type>>::value;
+                }
+                else
+                {
+                    return has_buffer_interface<E1>::value && xt_simd::has_stream_store<value_type>::value;
+                }
+            }
+
+            template <class E1, class E2>
+            static void run(E1& e1, const E2& e2, const execution_policy& policy);
+        };
+
+        template <bool simd>
+        template <class E1, class E2>
+        inline void streaming_assigner<simd>::run(E1& e1, const E2& e2, const execution_policy& policy)
         {
-            for (size_type i = align_begin; i < align_end; i += simd_size)
+            using e1_value_type = typename E1::value_type;
+            constexpr std::size_t simd_size = simd ? xt_simd::simd_traits<e1_value_type>::size : 1;
+            constexpr std::size_t cost = expression_cost<E2>::value + 1;
+
+            e1_value_type* dst = e1.data() + e1.data_offset();
+            std::size_t size = static_cast<std::size_t>(e1.size());
+            std::size_t align_begin = 0;
+            if constexpr (simd)
             {
-                e1.template store_simd<lhs_align_mode>(i, e2.template load_simd<rhs_align_mode, value_type>(i));
+                align_begin = xt_simd::get_alignment_offset(dst, size, simd_size);
+                for (std::size_t i = 0; i < align_begin; ++i)
+                {
+                    dst[i] = conditional_cast<true, e1_value_type>(e2.data_element(i));
+                }
             }
-        }
-#elif defined(XTENSOR_USE_OPENMP)
-        if (size >= size_type(XTENSOR_OPENMP_TRESHOLD))
-        {
-#pragma omp parallel for default(none) shared(align_begin, align_end, e1, e2)
-#ifndef _WIN32
-            for (size_type i = align_begin; i < align_end; i += simd_size)
+            std::size_t nb_blocks = (size - align_begin) / simd_size;
+
+            // Non-temporal stores are weakly ordered, every thread issuing
+            // some of them must fence them.
+            auto assign_blocks = [dst, &e2, align_begin](std::size_t first, std::size_t last)
             {
-                e1.template store_simd<lhs_align_mode>(i, e2.template load_simd<rhs_align_mode, value_type>(i));
+                if constexpr (simd)
+                {
+                    for (std::size_t i = align_begin + first * simd_size; i < align_begin + last * simd_size;
+                         i += simd_size)
+                    {
+                        auto batch = e2.template load_simd<unaligned_mode, e1_value_type>(i);
+                        xt_simd::store_stream(dst + i, batch);
+                    }
+                }
+                else
+                {
+                    auto src = linear_begin(e2) + static_cast<std::ptrdiff_t>(first);
+                    for (std::size_t i = first; i < last; ++i, ++src)
+                    {
+                        xt_simd::store_stream(dst + i, conditional_cast<true, e1_value_type>(*src));
+                    }
+                }
+                xt_simd::stream_fence();
+            };
+
+            if (policy.use_parallel(size, cost))
+            {
+                std::size_t grain = policy.grain_size(cost * simd_size);
+                parallel_for(policy, std::size_t(0), nb_blocks, assign_blocks, grain);
             }
-#else
-            for (auto i = static_cast<std::ptrdiff_t>(align_begin); i < static_cast<std::ptrdiff_t>(align_end);
-                 i += static_cast<std::ptrdiff_t>(simd_size))
+            else
             {
-                size_type ui = static_cast<size_type>(i);
-                e1.template store_simd<lhs_align_mode>(ui, e2.template load_simd<rhs_align_mode, value_type>(ui));
+                assign_blocks(std::size_t(0), nb_blocks);
             }
-#endif
-        }
-        else
-        {
-            for (size_type i = align_begin; i < align_end; i += simd_size)
+
+            if constexpr (simd)
             {
-                e1.template store_simd<lhs_align_mode>(i, e2.template load_simd<rhs_align_mode, value_type>(i));
+                for (std::size_t i = align_begin + nb_blocks * simd_size; i < size; ++i)
+                {
+                    dst[i] = conditional_cast<true, e1_value_type>(e2.data_element(i));
+                }
             }
         }
-#else
-        for (size_type i = align_begin; i < align_end; i += simd_size)
-        {
-            e1.template store_simd<lhs_align_mode>(i, e2.template load_simd<rhs_align_mode, value_type>(i));
-        }
-#endif
-        for (size_type i = align_end; i < size; ++i)
+
+        /**
+         * Assignment of an expression to the buffer of e1 when their value types are
+         * different arithmetic types. The expression is evaluated block by block in
+         * its own value type, with SIMD instructions when possible, and the blocks
+         * are converted with xt_simd::convert. Without xsimd, compilers vectorize
+         * the plain assignment loops as well, so this is only used with xsimd.
+         */
+        template <class E1, class E2>
+        struct conversion_assigner
         {
-            e1.data_element(i) = conditional_cast<needs_cast, e1_value_type>(e2.data_element(i));
-        }
-    }
+            using dst_type = typename E1::value_type;
+            using src_type = typename E2::value_type;
 
-    template <class E1, class E2>
-    inline void linear_assigner<false>::run(E1& e1, const E2& e2)
-    {
-        using is_convertible = std::
-            is_convertible<typename std::decay_t<E2>::value_type, typename std::decay_t<E1>::value_type>;
-        // If the types are not compatible, this function is still instantiated but never called.
-        // To avoid compilation problems in effectively unused code trivial_assigner_run_impl is
-        // empty in this case.
-        run_impl(e1, e2, is_convertible());
-    }
+            static constexpr std::size_t simd_size = xt_simd::simd_traits<src_type>::size;
 
-    template <class E1, class E2>
-    inline void linear_assigner<false>::run_impl(E1& e1, const E2& e2, std::true_type /*is_convertible*/)
-    {
-        using value_type = typename E1::value_type;
-        using size_type = typename E1::size_type;
-        auto src = linear_begin(e2);
-        auto dst = linear_begin(e1);
-        size_type n = e1.size();
-#if defined(XTENSOR_USE_TBB)
-        tbb::static_partitioner sp;
-        tbb::parallel_for(
-            std::ptrdiff_t(0),
-            static_cast<std::ptrdiff_t>(n),
-            [&](std::ptrdiff_t i)
-            {
-                *(dst + i) = static_cast<value_type>(*(src + i));
-            },
-            sp
-        );
-#elif defined(XTENSOR_USE_OPENMP)
-        if (n >= XTENSOR_OPENMP_TRESHOLD)
-        {
-#pragma omp parallel for default(none) shared(src, dst, n)
-            for (std::ptrdiff_t i = std::ptrdiff_t(0); i < static_cast<std::ptrdiff_t>(n); i++)
+            static constexpr bool available()
             {
-                *(dst + i) = static_cast<value_type>(*(src + i));
+                return has_buffer_interface<E1>::value && simd_size > 1
+                       && xt_simd::is_convertible_arithmetic<src_type, dst_type>::value;
             }
-        }
-        else
+
+            static constexpr bool simd_source = simd_size > 1 && has_simd_interface<E2, src_type>::value;
+
+            // A block fits in a quarter of the L1 cache
+            static constexpr std::size_t block_size = XTENSOR_L1_CACHE_SIZE / (4 * sizeof(src_type));
+
+            static void run(E1& e1, const E2& e2, const execution_policy& policy);
+
+            template <class S1, class S2>
+            static void run_inner(S1& dst_stepper, S2& src_stepper, std::size_t size);
+        };
+
+        template <class E1, class E2>
+        inline void conversion_assigner<E1, E2>::run(E1& e1, const E2& e2, const execution_policy& policy)
         {
-            for (; n > size_type(0); --n)
+            constexpr std::size_t cost = expression_cost<E2>::value + 1;
+            dst_type* dst = e1.data() + e1.data_offset();
+            std::size_t size = static_cast<std::size_t>(e1.size());
+            std::size_t nb_blocks = (size + block_size - 1) / block_size;
+
+            auto assign_blocks = [dst, &e2, size](std::size_t first, std::size_t last)
             {
-                *dst = static_cast<value_type>(*src);
-                ++src;
-                ++dst;
+                for (std::size_t block = first; block < last; ++block)
+                {
+                    std::size_t i = block * block_size;
+                    std::size_t n = std::min(block_size, size - i);
+                    if constexpr (has_buffer_interface<E2>::value)
+                    {
+                        xt_simd::convert(e2.data() + e2.data_offset() + i, dst + i, n);
+                    }
+                    else
+                    {
+                        src_type buffer[block_size];
+                        std::size_t k = 0;
+                        if constexpr (simd_source)
+                        {
+                            for (; k + simd_size <= n; k += simd_size)
+                            {
+                                auto batch = e2.template load_simd<unaligned_mode, src_type>(i + k);
+                                xt_simd::store_as(buffer + k, batch, unaligned_mode());
+                            }
+                        }
+                        auto src = linear_begin(e2) + static_cast<std::ptrdiff_t>(i + k);
+                        for (; k < n; ++k, ++src)
+                        {
+                            buffer[k] = *src;
+                        }
+                        xt_simd::convert(buffer, dst + i, n);
+                    }
+                }
+            };
+
+            if (policy.use_parallel(size, cost))
+            {
+                parallel_for(policy, std::size_t(0), nb_blocks, assign_blocks, 1);
+            }
+            else
+            {
+                assign_blocks(std::size_t(0), nb_blocks);
             }
         }
-#else
-        for (; n > size_type(0); --n)
+
+        /**
+         * Assigns the \p size next elements of the inner loop of a strided assignment,
+         * along which both steppers have a unit stride.
+         */
+        template <class E1, class E2>
+        template <class S1, class S2>
+        inline void conversion_assigner<E1, E2>::run_inner(S1& dst_stepper, S2& src_stepper, std::size_t size)
         {
-            *dst = static_cast<value_type>(*src);
-            ++src;
-            ++dst;
+            dst_type* dst = std::addressof(*dst_stepper);
+            src_type buffer[block_size];
+            for (std::size_t i = 0; i < size; i += block_size)
+            {
+                std::size_t n = std::min(block_size, size - i);
+                std::size_t k = 0;
+                if constexpr (simd_source)
+                {
+                    for (; k + simd_size <= n; k += simd_size)
+                    {
+                        auto batch = src_stepper.template step_simd<src_type>();
+                        xt_simd::store_as(buffer + k, batch, unaligned_mode());
+                    }
+                }
+                for (; k < n; ++k)
+                {
+                    buffer[k] = *src_stepper;
+                    src_stepper.step_leading();
+                }
+                xt_simd::convert(buffer, dst + i, n);
+            }
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                dst_stepper.step_leading();
+            }
+        }
+    }
+
+    template <bool simd_assign>
+    template <class E1, class E2>
+    inline void linear_assigner<simd_assign>::run(E1& e1, const E2& e2, const execution_policy& policy)
+    {
+        if constexpr (detail::streaming_assigner<true>::available<E1, E2>())
+        {
+            if (policy.use_streaming(e1.size() * sizeof(typename E1::value_type)))
+            {
+                detail::streaming_assigner<true>::run(e1, e2, policy);
+                return;
+            }
+        }
+        if constexpr (detail::conversion_assigner<E1, E2>::available())
+        {
+            detail::conversion_assigner<E1, E2>::run(e1, e2, policy);
+            return;
+        }
+
+        using lhs_align_mode = xt_simd::container_alignment_t<E1>;
+        constexpr bool is_aligned = std::is_same<lhs_align_mode, aligned_mode>::value;
+        using rhs_align_mode = std::conditional_t<is_aligned, inner_aligned_mode, unaligned_mode>;
+        using e1_value_type = typename E1::value_type;
+        using e2_value_type = typename E2::value_type;
+        using value_type = typename xassign_traits<E1, E2>::requested_value_type;
+        using simd_type = xt_simd::simd_type<value_type>;
+        using size_type = typename E1::size_type;
+        size_type size = e1.size();
+        constexpr size_type simd_size = simd_type::size;
+        constexpr bool needs_cast = has_assign_conversion<e2_value_type, e1_value_type>::value;
+        // Estimated cost of evaluating and storing one element
+        constexpr std::size_t cost = expression_cost<E2>::value + 1;
+
+        size_type align_begin = is_aligned ? 0 : xt_simd::get_alignment_offset(e1.data(), size, simd_size);
+        size_type align_end = align_begin + ((size - align_begin) & ~(simd_size - 1));
+
+        // The unaligned head and the tail are assigned with a single unaligned batch
+        // each, that overlaps the aligned batches. Both are loaded before any batch
+        // is stored and stored last, so that element-wise aliasing stays correct.
+        using batch_type = decltype(e2.template load_simd<unaligned_mode, value_type>(size_type(0)));
+        // The offset is smaller than a batch, or is size when the destination cannot
+        // be aligned, in which case it is assigned element-wise by the head loop.
+        XTENSOR_ASSERT(align_begin < simd_size || align_begin == size);
+        bool head_batch = align_begin != 0 && align_begin != size && size >= simd_size;
+        bool tail_batch = align_end != size && size >= simd_size;
+        batch_type head, tail;
+        if (head_batch)
+        {
+            head = e2.template load_simd<unaligned_mode, value_type>(0);
+        }
+        else
+        {
+            for (size_type i = 0; i < align_begin; ++i)
+            {
+                e1.data_element(i) = conditional_cast<needs_cast, e1_value_type>(e2.data_element(i));
+            }
+        }
+        if (tail_batch)
+        {
+            tail = e2.template load_simd<unaligned_mode, value_type>(size - simd_size);
+        }
+
+        auto assign_batches = [&e1, &e2](size_type first, size_type last)
+        {
+            for (size_type i = first; i < last; i += simd_size)
+            {
+                e1.template store_simd<lhs_align_mode>(i, e2.template load_simd<rhs_align_mode, value_type>(i));
+            }
+        };
+
+        if (policy.use_parallel(size, cost))
+        {
+            // Chunks are made of whole batches so that every worker keeps aligned stores
+            detail::parallel_for(
+                policy,
+                std::size_t(0),
+                static_cast<std::size_t>((align_end - align_begin) / simd_size),
+                [&assign_batches, align_begin](std::size_t first, std::size_t last)
+                {
+                    assign_batches(
+                        align_begin + static_cast<size_type>(first) * simd_size,
+                        align_begin + static_cast<size_type>(last) * simd_size
+                    );
+                },
+                policy.grain_size(cost * simd_size)
+            );
+        }
+        else
+        {
+            assign_batches(align_begin, align_end);
+        }
+
+        if (head_batch)
+        {
+            e1.template store_simd<unaligned_mode>(0, head);
+        }
+        if (tail_batch)
+        {
+            e1.template store_simd<unaligned_mode>(size - simd_size, tail);
+        }
+        else
+        {
+            for (size_type i = align_end; i < size; ++i)
+            {
+                e1.data_element(i) = conditional_cast<needs_cast, e1_value_type>(e2.data_element(i));
+            }
         }
-#endif
     }
 
     template <class E1, class E2>
-    inline void linear_assigner<false>::run_impl(E1&, const E2&, std::false_type /*is_convertible*/)
+    inline void linear_assigner<false>::run(E1& e1, const E2& e2, const execution_policy& policy)
+    {
+        using is_convertible = std::
+            is_convertible<typename std::decay_t<E2>::value_type, typename std::decay_t<E1>::value_type>;
+        // If the types are not compatible, this function is still instantiated but never called.
+        // To avoid compilation problems in effectively unused code trivial_assigner_run_impl is
+        // empty in this case.
+        run_impl(e1, e2, policy, is_convertible());
+    }
+
+    template <class E1, class E2>
+    inline void linear_assigner<false>::run_impl(
+        E1& e1,
+        const E2& e2,
+        const execution_policy& policy,
+        std::true_type /*is_convertible*/
+    )
+    {
+        using value_type = typename E1::value_type;
+        using size_type = typename E1::size_type;
+        if constexpr (detail::streaming_assigner<false>::available<E1, E2>())
+        {
+            if (policy.use_streaming(e1.size() * sizeof(value_type)))
+            {
+                detail::streaming_assigner<false>::run(e1, e2, policy);
+                return;
+            }
+        }
+        if constexpr (detail::conversion_assigner<E1, E2>::available())
+        {
+            detail::conversion_assigner<E1, E2>::run(e1, e2, policy);
+            return;
+        }
+        auto src = linear_begin(e2);
+        auto dst = linear_begin(e1);
+        size_type n = e1.size();
+        constexpr std::size_t cost = expression_cost<E2>::value + 1;
+        if (policy.use_parallel(n, cost))
+        {
+            detail::parallel_for(
+                policy,
+                std::size_t(0),
+                static_cast<std::size_t>(n),
+                [&src, &dst](std::size_t first, std::size_t last)
+                {
+                    auto chunk_src = src + static_cast<std::ptrdiff_t>(first);
+                    auto chunk_dst = dst + static_cast<std::ptrdiff_t>(first);
+                    for (std::size_t i = first; i < last; ++i)
+                    {
+                        *chunk_dst = conditional_cast<true, value_type>(*chunk_src);
+                        ++chunk_src;
+                        ++chunk_dst;
+                    }
+                },
+                policy.grain_size(cost)
+            );
+        }
+        else
+        {
+            for (; n > size_type(0); --n)
+            {
+                *dst = conditional_cast<true, value_type>(*src);
+                ++src;
+                ++dst;
+            }
+        }
+    }
+
+    template <class E1, class E2>
+    inline void linear_assigner<false>::run_impl(
+        E1&,
+        const E2&,
+        const execution_policy&,
+        std::false_type /*is_convertible*/
+    )
     {
         XTENSOR_PRECONDITION(false, "Internal error: linear_assigner called with unrelated types.");
     }
@@ -1095,11 +1724,14 @@ namespace xt
         return strided_assign_detail::get_loop_sizes<simd>(e1, e2);
     }
 
-#define strided_parallel_assign
-
     template <bool simd>
     template <class E1, class E2>
-    inline void strided_loop_assigner<simd>::run(E1& e1, const E2& e2, const loop_sizes_t& loop_sizes)
+    inline void strided_loop_assigner<simd>::run(
+        E1& e1,
+        const E2& e2,
+        const loop_sizes_t& loop_sizes,
+        const execution_policy& policy
+    )
     {
         bool is_row_major = loop_sizes.is_row_major;
         std::size_t inner_loop_size = loop_sizes.inner_loop_size;
@@ -1135,9 +1767,6 @@ namespace xt
         std::size_t simd_size = inner_loop_size / simd_type::size;
         std::size_t simd_rest = inner_loop_size % simd_type::size;
 
-        auto fct_stepper = e2.stepper_begin(e1.shape());
-        auto res_stepper = e1.stepper_begin(e1.shape());
-
         // TODO in 1D case this is ambiguous -- could be RM or CM.
         //      Use default layout to make decision
         std::size_t step_dim = 0;
@@ -1145,42 +1774,75 @@ namespace xt
         {
             step_dim = cut;
         }
-#if defined(XTENSOR_USE_OPENMP) && defined(strided_parallel_assign)
-        if (outer_loop_size >= XTENSOR_OPENMP_TRESHOLD / inner_loop_size)
+
+        using row_major_tools = strided_assign_detail::idx_tools<layout_type::row_major>;
+        using column_major_tools = strided_assign_detail::idx_tools<layout_type::column_major>;
+
+        // Assigns the outer iterations [ox_first, ox_last), each worker of a parallel
+        // assignment runs it with its own steppers and index.
+        auto assign_outer_range =
+            [&e1, &e2, &idx, &max_shape, is_row_major, step_dim, inner_loop_size, simd_size, simd_rest](
+                std::size_t ox_first,
+                std::size_t ox_last
+            )
         {
-            std::size_t first_step = true;
-#pragma omp parallel for schedule(static) firstprivate(first_step, fct_stepper, res_stepper, idx)
-            for (std::size_t ox = 0; ox < outer_loop_size; ++ox)
+            auto fct_stepper = e2.stepper_begin(e1.shape());
+            auto res_stepper = e1.stepper_begin(e1.shape());
+            auto outer_index = idx;
+
+            if (ox_first != 0)
             {
-                if (first_step)
-                {
-                    is_row_major
-                        ? strided_assign_detail::idx_tools<layout_type::row_major>::nth_idx(ox, idx, max_shape)
-                        : strided_assign_detail::idx_tools<layout_type::column_major>::nth_idx(ox, idx, max_shape);
+                is_row_major ? row_major_tools::nth_idx(ox_first, outer_index, max_shape)
+                             : column_major_tools::nth_idx(ox_first, outer_index, max_shape);
 
-                    for (std::size_t i = 0; i < idx.size(); ++i)
-                    {
-                        fct_stepper.step(i + step_dim, idx[i]);
-                        res_stepper.step(i + step_dim, idx[i]);
-                    }
-                    first_step = false;
+                for (std::size_t i = 0; i < outer_index.size(); ++i)
+                {
+                    fct_stepper.step(i + step_dim, outer_index[i]);
+                    res_stepper.step(i + step_dim, outer_index[i]);
                 }
+            }
 
-                for (std::size_t i = 0; i < simd_size; ++i)
+            for (std::size_t ox = ox_first; ox < ox_last; ++ox)
+            {
+                if constexpr (detail::conversion_assigner<E1, E2>::available())
                 {
-                    res_stepper.store_simd(fct_stepper.template step_simd<value_type>());
+                    detail::conversion_assigner<E1, E2>::run_inner(res_stepper, fct_stepper, inner_loop_size);
                 }
-                for (std::size_t i = 0; i < simd_rest; ++i)
+                else if (simd_size != 0 && simd_rest != 0)
                 {
-                    *(res_stepper) = conditional_cast<needs_cast, e1_value_type>(*(fct_stepper));
-                    res_stepper.step_leading();
-                    fct_stepper.step_leading();
+                    // The remainder is assigned with a first batch that overlaps the
+                    // next ones; it is loaded first and stored last, so that element-wise
+                    // aliasing stays correct.
+                    auto head_res_stepper = res_stepper;
+                    auto head_fct_stepper = fct_stepper;
+                    auto head = head_fct_stepper.template step_simd<value_type>();
+                    for (std::size_t i = 0; i < simd_rest; ++i)
+                    {
+                        res_stepper.step_leading();
+                        fct_stepper.step_leading();
+                    }
+                    for (std::size_t i = 0; i < simd_size; ++i)
+                    {
+                        res_stepper.store_simd(fct_stepper.template step_simd<value_type>());
+                    }
+                    head_res_stepper.store_simd(head);
+                }
+                else
+                {
+                    for (std::size_t i = 0; i < simd_size; ++i)
+                    {
+                        res_stepper.store_simd(fct_stepper.template step_simd<value_type>());
+                    }
+                    for (std::size_t i = 0; i < simd_rest; ++i)
+                    {
+                        *(res_stepper) = conditional_cast<needs_cast, e1_value_type>(*(fct_stepper));
+                        res_stepper.step_leading();
+                        fct_stepper.step_leading();
+                    }
                 }
 
-                // next unaligned index
-                is_row_major
-                    ? strided_assign_detail::idx_tools<layout_type::row_major>::next_idx(idx, max_shape)
-                    : strided_assign_detail::idx_tools<layout_type::column_major>::next_idx(idx, max_shape);
+                is_row_major ? row_major_tools::next_idx(outer_index, max_shape)
+                             : column_major_tools::next_idx(outer_index, max_shape);
 
                 fct_stepper.to_begin();
 
@@ -1188,173 +1850,626 @@ namespace xt
                 if (!E1::contiguous_layout)
                 {
                     res_stepper.to_begin();
-                    for (std::size_t i = 0; i < idx.size(); ++i)
+                    for (std::size_t i = 0; i < outer_index.size(); ++i)
                     {
-                        fct_stepper.step(i + step_dim, idx[i]);
-                        res_stepper.step(i + step_dim, idx[i]);
+                        fct_stepper.step(i + step_dim, outer_index[i]);
+                        res_stepper.step(i + step_dim, outer_index[i]);
                     }
                 }
                 else
                 {
-                    for (std::size_t i = 0; i < idx.size(); ++i)
+                    for (std::size_t i = 0; i < outer_index.size(); ++i)
                     {
-                        fct_stepper.step(i + step_dim, idx[i]);
+                        fct_stepper.step(i + step_dim, outer_index[i]);
                     }
                 }
             }
+        };
+
+        constexpr std::size_t cost = expression_cost<E2>::value + 1;
+        if (policy.use_parallel(outer_loop_size * inner_loop_size, cost))
+        {
+            detail::parallel_for(
+                policy,
+                std::size_t(0),
+                outer_loop_size,
+                assign_outer_range,
+                policy.grain_size(cost * inner_loop_size)
+            );
         }
         else
         {
-#elif defined(strided_parallel_assign) && defined(XTENSOR_USE_TBB)
-        if (outer_loop_size > XTENSOR_TBB_THRESHOLD / inner_loop_size)
+            assign_outer_range(std::size_t(0), outer_loop_size);
+        }
+    }
+
+    template <>
+    template <class E1, class E2>
+    inline void strided_loop_assigner<true>::run(E1& e1, const E2& e2, const execution_policy& policy)
+    {
+        strided_assign_detail::loop_sizes_t loop_sizes = strided_loop_assigner<true>::get_loop_sizes(e1, e2);
+        if (loop_sizes.can_do_strided_assign)
         {
-            tbb::static_partitioner sp;
-            tbb::parallel_for(
-                tbb::blocked_range<size_t>(0ul, outer_loop_size),
-                [&e1, &e2, is_row_major, step_dim, simd_size, simd_rest, &max_shape, &idx_ = idx](
-                    const tbb::blocked_range<size_t>& r
-                )
+            run(e1, e2, loop_sizes, policy);
+        }
+        else
+        {
+            // trigger the fallback assigner
+            stepper_assigner<E1, E2, default_assignable_layout(E1::static_layout)>(e1, e2).run(policy);
+        }
+    }
+
+    template <>
+    template <class E1, class E2>
+    inline void
+    strided_loop_assigner<false>::run(E1& /*e1*/, const E2& /*e2*/, const loop_sizes_t&, const execution_policy&)
+    {
+    }
+
+    template <>
+    template <class E1, class E2>
+    inline void strided_loop_assigner<false>::run(E1& e1, const E2& e2, const execution_policy& policy)
+    {
+        // trigger the fallback assigner
+        stepper_assigner<E1, E2, default_assignable_layout(E1::static_layout)>(e1, e2).run(policy);
+    }
+
+    /*********************************
+     * tiled_assigner implementation *
+     *********************************/
+
+    namespace tiled_assign_detail
+    {
+        /**
+         * Returns the largest power of two such that a square tile of the source
+         * and of the destination fit together in a quarter of the L1 cache.
+         */
+        template <class T1, class T2>
+        constexpr std::size_t tile_size()
+        {
+            constexpr std::size_t element_size = sizeof(T1) + sizeof(T2);
+            std::size_t size = 8;
+            while (4 * (2 * size) * (2 * size) * element_size <= XTENSOR_L1_CACHE_SIZE)
+            {
+                size *= 2;
+            }
+            return size;
+        }
+
+        inline std::size_t
+        unit_stride_dim(const dynamic_shape<std::size_t>& shape, const dynamic_shape<std::ptrdiff_t>& strides)
+        {
+            std::size_t dim = shape.size();
+            for (std::size_t i = 0; i < shape.size(); ++i)
+            {
+                if (strides[i] == 1 && shape[i] > 1)
                 {
-                    auto idx = idx_;
-                    auto fct_stepper = e2.stepper_begin(e1.shape());
-                    auto res_stepper = e1.stepper_begin(e1.shape());
-                    std::size_t first_step = true;
-                    // #pragma omp parallel for schedule(static) firstprivate(first_step, fct_stepper,
-                    // res_stepper, idx)
-                    for (std::size_t ox = r.begin(); ox < r.end(); ++ox)
-                    {
-                        if (first_step)
-                        {
-                            is_row_major
-                                ? strided_assign_detail::idx_tools<layout_type::row_major>::nth_idx(ox, idx, max_shape)
-                                : strided_assign_detail::idx_tools<layout_type::column_major>::nth_idx(
-                                    ox,
-                                    idx,
-                                    max_shape
-                                );
-
-                            for (std::size_t i = 0; i < idx.size(); ++i)
-                            {
-                                fct_stepper.step(i + step_dim, idx[i]);
-                                res_stepper.step(i + step_dim, idx[i]);
-                            }
-                            first_step = false;
-                        }
+                    dim = i;
+                }
+            }
+            return dim;
+        }
+    }
 
-                        for (std::size_t i = 0; i < simd_size; ++i)
-                        {
-                            res_stepper.store_simd(fct_stepper.template step_simd<value_type>());
-                        }
-                        for (std::size_t i = 0; i < simd_rest; ++i)
-                        {
-                            *(res_stepper) = conditional_cast<needs_cast, e1_value_type>(*(fct_stepper));
-                            res_stepper.step_leading();
-                            fct_stepper.step_leading();
-                        }
+    template <>
+    template <class E1, class E2>
+    inline auto tiled_assigner<false>::get_tile_loop(const E1&, const E2&) -> tile_loop_t
+    {
+        return tile_loop_t{false, 0, 0, 0, 0, 0, 0, {}, {}, {}};
+    }
 
-                        // next unaligned index
-                        is_row_major
-                            ? strided_assign_detail::idx_tools<layout_type::row_major>::next_idx(idx, max_shape)
-                            : strided_assign_detail::idx_tools<layout_type::column_major>::next_idx(idx, max_shape);
+    template <>
+    template <class E1, class E2>
+    inline void tiled_assigner<false>::run(E1&, const E2&, const tile_loop_t&, const execution_policy&)
+    {
+    }
 
-                        fct_stepper.to_begin();
+    template <>
+    template <class E1, class E2>
+    inline auto tiled_assigner<true>::get_tile_loop(const E1& e1, const E2& e2) -> tile_loop_t
+    {
+        using e1_value_type = typename E1::value_type;
+        using e2_value_type = typename E2::value_type;
+        constexpr std::size_t tile_size = tiled_assign_detail::tile_size<e1_value_type, e2_value_type>();
 
-                        // need to step E1 as well if not contigous assign (e.g. view)
-                        if (!E1::contiguous_layout)
-                        {
-                            res_stepper.to_begin();
-                            for (std::size_t i = 0; i < idx.size(); ++i)
-                            {
-                                fct_stepper.step(i + step_dim, idx[i]);
-                                res_stepper.step(i + step_dim, idx[i]);
-                            }
-                        }
-                        else
-                        {
-                            for (std::size_t i = 0; i < idx.size(); ++i)
-                            {
-                                fct_stepper.step(i + step_dim, idx[i]);
-                            }
-                        }
+        tile_loop_t loop{false, 0, 0, tile_size, 0, 0, 0, {}, {}, {}};
+        std::size_t dim = e1.dimension();
+        if (dim < 2 || e2.dimension() != dim || e1.size() < tile_size * tile_size
+            || !std::equal(e1.shape().cbegin(), e1.shape().cend(), e2.shape().cbegin()))
+        {
+            return loop;
+        }
+
+        dynamic_shape<std::size_t> shape(e1.shape().cbegin(), e1.shape().cend());
+        dynamic_shape<std::ptrdiff_t> strides1(e1.strides().cbegin(), e1.strides().cend());
+        dynamic_shape<std::ptrdiff_t> strides2(e2.strides().cbegin(), e2.strides().cend());
+        loop.write_dim = tiled_assign_detail::unit_stride_dim(shape, strides1);
+        loop.read_dim = tiled_assign_detail::unit_stride_dim(shape, strides2);
+        if (loop.write_dim == dim || loop.read_dim == dim || loop.write_dim == loop.read_dim)
+        {
+            // Either both expressions are traversed along the same dimension,
+            // which is what the other assigners do best, or one of them has
+            // no unit stride at all and tiling does not help.
+            return loop;
+        }
+
+        dynamic_shape<std::size_t> outer_dims;
+        for (std::size_t i = 0; i < dim; ++i)
+        {
+            if (i != loop.write_dim && i != loop.read_dim)
+            {
+                outer_dims.push_back(i);
+            }
+        }
+        std::stable_sort(
+            outer_dims.begin(),
+            outer_dims.end(),
+            [&strides1](std::size_t lhs, std::size_t rhs)
+            {
+                return std::abs(strides1[lhs]) > std::abs(strides1[rhs]);
+            }
+        );
+
+        std::size_t nb_outer = 1;
+        for (std::size_t d : outer_dims)
+        {
+            loop.outer_shape.push_back(shape[d]);
+            loop.outer_strides1.push_back(strides1[d]);
+            loop.outer_strides2.push_back(strides2[d]);
+            nb_outer *= shape[d];
+        }
+        loop.nb_write_tiles = (shape[loop.write_dim] + tile_size - 1) / tile_size;
+        loop.nb_read_tiles = (shape[loop.read_dim] + tile_size - 1) / tile_size;
+        loop.nb_tiles = nb_outer * loop.nb_read_tiles * loop.nb_write_tiles;
+        loop.can_do_tiled_assign = true;
+        return loop;
+    }
+
+    template <>
+    template <class E1, class E2>
+    inline void
+    tiled_assigner<true>::run(E1& e1, const E2& e2, const tile_loop_t& loop, const execution_policy& policy)
+    {
+        using e1_value_type = typename E1::value_type;
+        using e2_value_type = typename E2::value_type;
+        constexpr bool needs_cast = has_assign_conversion<e2_value_type, e1_value_type>::value;
+
+        auto* dst = e1.data() + e1.data_offset();
+        const auto* src = e2.data() + e2.data_offset();
+        std::size_t write_size = e1.shape()[loop.write_dim];
+        std::size_t read_size = e1.shape()[loop.read_dim];
+        std::ptrdiff_t dst_read_stride = static_cast<std::ptrdiff_t>(e1.strides()[loop.read_dim]);
+        std::ptrdiff_t src_write_stride = static_cast<std::ptrdiff_t>(e2.strides()[loop.write_dim]);
+
+        // Tiles are numbered with the outer dimensions first, then the
+        // dimension read contiguously, then the one written contiguously.
+        auto assign_tiles = [&](std::size_t first, std::size_t last)
+        {
+            std::size_t tiles_per_outer = loop.nb_read_tiles * loop.nb_write_tiles;
+            for (std::size_t t = first; t < last; ++t)
+            {
+                std::size_t outer = t / tiles_per_outer;
+                std::size_t read_tile = (t % tiles_per_outer) / loop.nb_write_tiles;
+                std::size_t write_tile = t % loop.nb_write_tiles;
+
+                std::ptrdiff_t offset1 = 0;
+                std::ptrdiff_t offset2 = 0;
+                for (std::size_t i = loop.outer_shape.size(); i > 0; --i)
+                {
+                    std::ptrdiff_t idx = static_cast<std::ptrdiff_t>(outer % loop.outer_shape[i - 1]);
+                    outer /= loop.outer_shape[i - 1];
+                    offset1 += idx * loop.outer_strides1[i - 1];
+                    offset2 += idx * loop.outer_strides2[i - 1];
+                }
+
+                std::size_t r_first = read_tile * loop.tile_size;
+                std::size_t r_last = std::min(r_first + loop.tile_size, read_size);
+                std::size_t w_first = write_tile * loop.tile_size;
+                std::size_t w_last = std::min(w_first + loop.tile_size, write_size);
+                for (std::size_t r = r_first; r < r_last; ++r)
+                {
+                    auto* d = dst + offset1 + static_cast<std::ptrdiff_t>(r) * dst_read_stride;
+                    const auto* s = src + offset2 + static_cast<std::ptrdiff_t>(r);
+                    for (std::size_t w = w_first; w < w_last; ++w)
+                    {
+                        d[w] = conditional_cast<needs_cast, e1_value_type>(
+                            s[static_cast<std::ptrdiff_t>(w) * src_write_stride]
+                        );
                     }
-                },
-                sp
+                }
+            }
+        };
+
+        constexpr std::size_t cost = expression_cost<E2>::value + 1;
+        if (policy.use_parallel(e1.size(), cost))
+        {
+            detail::parallel_for(
+                policy,
+                std::size_t(0),
+                loop.nb_tiles,
+                assign_tiles,
+                policy.grain_size(cost * loop.tile_size * loop.tile_size)
             );
         }
         else
         {
+            assign_tiles(std::size_t(0), loop.nb_tiles);
+        }
+    }
 
-#endif
-            for (std::size_t ox = 0; ox < outer_loop_size; ++ox)
+    /*****************************
+     * assign_all implementation *
+     *****************************/
+
+    namespace detail
+    {
+        /**
+         * Moves several steppers together, so that a single index traversal
+         * drives the steppers of all the outputs and expressions of assign_all.
+         */
+        template <class... S>
+        class multi_stepper
+        {
+        public:
+
+            using size_type = std::common_type_t<typename S::size_type...>;
+
+            explicit multi_stepper(S&&... s)
+                : m_steppers(std::move(s)...)
+            {
+            }
+
+            void step(size_type i)
             {
-                for (std::size_t i = 0; i < simd_size; ++i)
+                std::apply(
+                    [i](auto&... s)
+                    {
+                        (s.step(i), ...);
+                    },
+                    m_steppers
+                );
+            }
+
+            void step(size_type i, size_type n)
+            {
+                std::apply(
+                    [i, n](auto&... s)
+                    {
+                        (s.step(i, n), ...);
+                    },
+                    m_steppers
+                );
+            }
+
+            void reset(size_type i)
+            {
+                std::apply(
+                    [i](auto&... s)
+                    {
+                        (s.reset(i), ...);
+                    },
+                    m_steppers
+                );
+            }
+
+            void to_end(layout_type l)
+            {
+                std::apply(
+                    [l](auto&... s)
+                    {
+                        (s.to_end(l), ...);
+                    },
+                    m_steppers
+                );
+            }
+
+            std::tuple<S...> m_steppers;
+        };
+
+        template <class E, class = void>
+        struct has_resize : std::false_type
+        {
+        };
+
+        template <class E>
+        struct has_resize<
+            E,
+            void_t<decltype(std::declval<E&>().resize(std::declval<const typename E::shape_type&>()))>>
+            : std::true_type
+        {
+        };
+
+        /**
+         * Prepares an output of assign_all the way its semantic does before an
+         * assignment: containers are resized, views must have a compatible shape.
+         * Returns true if the broadcasting of the expression is trivial.
+         */
+        template <class E1, class E2>
+        inline bool prepare_assign_output(E1& e1, const E2& e2)
+        {
+            if constexpr (has_resize<E1>::value)
+            {
+                return xexpression_assigner<xexpression_tag_t<E1, E2>>::resize(e1, e2);
+            }
+            else
+            {
+                xt::assert_compatible_shape(e1, e2);
+                using index_type = xindex_type_t<typename E2::shape_type>;
+                index_type shape = uninitialized_shape<index_type>(e2.dimension());
+                return e2.broadcast_shape(shape, true);
+            }
+        }
+
+        template <class O, class E, class S = std::make_index_sequence<std::tuple_size<O>::value>>
+        class multi_assigner;
+
+        template <class... O, class... E, std::size_t... I>
+        class multi_assigner<std::tuple<O&...>, std::tuple<const E&...>, std::index_sequence<I...>>
+        {
+        public:
+
+            using output_tuple = std::tuple<O&...>;
+            using expression_tuple = std::tuple<const E&...>;
+
+            static void run(output_tuple o, expression_tuple e, const execution_policy& policy)
+            {
+                // Every output is resized, even if the first resize shows that
+                // the broadcasting is not trivial.
+                bool trivial = (true & ... & prepare_assign_output(std::get<I>(o), std::get<I>(e)));
+
+                if (!same_shape(o))
                 {
-                    res_stepper.store_simd(fct_stepper.template step_simd<value_type>());
+                    run_separate(o, e, policy);
                 }
-                for (std::size_t i = 0; i < simd_rest; ++i)
+                else if (trivial && linear_assign(o, e))
                 {
-                    *(res_stepper) = conditional_cast<needs_cast, e1_value_type>(*(fct_stepper));
-                    res_stepper.step_leading();
-                    fct_stepper.step_leading();
+                    if constexpr (simd_assign())
+                    {
+                        if ((... && simd_linear_assign<I>(std::get<I>(o), std::get<I>(e))))
+                        {
+                            run_linear_simd(o, e, policy);
+                            return;
+                        }
+                    }
+                    run_linear(o, e, policy);
+                }
+                else
+                {
+                    run_stepper(o, e);
                 }
+            }
 
-                is_row_major
-                    ? strided_assign_detail::idx_tools<layout_type::row_major>::next_idx(idx, max_shape)
-                    : strided_assign_detail::idx_tools<layout_type::column_major>::next_idx(idx, max_shape);
+        private:
 
-                fct_stepper.to_begin();
+            static constexpr std::size_t nb_outputs = sizeof...(O);
 
-                // need to step E1 as well if not contigous assign (e.g. view)
-                if (!E1::contiguous_layout)
+            template <std::size_t K>
+            using output_t = std::tuple_element_t<K, std::tuple<O...>>;
+
+            template <std::size_t K>
+            using output_value_t = typename output_t<K>::value_type;
+
+            template <std::size_t K>
+            using expression_t = std::tuple_element_t<K, std::tuple<E...>>;
+
+            template <std::size_t K>
+            using traits = xassign_traits<output_t<K>, expression_t<K>>;
+
+            template <std::size_t K>
+            using requested_value_t = typename traits<K>::requested_value_type;
+
+            template <std::size_t K>
+            static constexpr bool needs_cast()
+            {
+                return has_assign_conversion<typename expression_t<K>::value_type, output_value_t<K>>::value;
+            }
+
+            static constexpr std::size_t cost()
+            {
+                return ((expression_cost<E>::value + 1) + ...);
+            }
+
+            static constexpr bool simd_assign()
+            {
+                constexpr std::size_t simd_size = xt_simd::simd_traits<requested_value_t<0>>::size;
+                return (traits<I>::simd_assign() && ...)
+                       && ((xt_simd::simd_traits<requested_value_t<I>>::size == simd_size) && ...);
+            }
+
+            template <std::size_t K>
+            static bool simd_linear_assign(const output_t<K>& o, const expression_t<K>& e)
+            {
+                return traits<K>::simd_linear_assign() || traits<K>::simd_linear_assign(o, e);
+            }
+
+            static bool same_shape(const output_tuple& o)
+            {
+                const auto& shape = std::get<0>(o).shape();
+                return (
+                    ...
+                    && std::equal(
+                        shape.cbegin(),
+                        shape.cend(),
+                        std::get<I>(o).shape().cbegin(),
+                        std::get<I>(o).shape().cend()
+                    )
+                );
+            }
+
+            static bool linear_assign(const output_tuple& o, const expression_tuple& e)
+            {
+                // The outputs must be traversed in the same order for the linear
+                // indices to match, which holds for contiguous outputs of the same
+                // layout, or of dimension 1.
+                const auto& first = std::get<0>(o);
+                bool same_order = first.dimension() <= 1
+                                  || (... && (std::get<I>(o).is_contiguous()
+                                              && std::get<I>(o).layout() == first.layout()));
+                return same_order && (... && is_linear_assign(std::get<I>(o), std::get<I>(e)));
+            }
+
+            static void
+            run_linear_simd(output_tuple& o, const expression_tuple& e, const execution_policy& policy)
+            {
+                using size_type = std::size_t;
+                constexpr size_type simd_size = xt_simd::simd_traits<requested_value_t<0>>::size;
+                size_type size = static_cast<size_type>(std::get<0>(o).size());
+                size_type align_end = size - size % simd_size;
+
+                // All the batches of an index are loaded before any of them is stored, so
+                // that an output can also be an operand of the other expressions.
+                auto assign_batches = [&o, &e](size_type first, size_type last)
                 {
-                    res_stepper.to_begin();
-                    for (std::size_t i = 0; i < idx.size(); ++i)
+                    for (size_type i = first; i < last; i += simd_size)
                     {
-                        fct_stepper.step(i + step_dim, idx[i]);
-                        res_stepper.step(i + step_dim, idx[i]);
+                        auto batches = std::make_tuple(
+                            std::get<I>(e).template load_simd<unaligned_mode, requested_value_t<I>>(i)...
+                        );
+                        (std::get<I>(o).template store_simd<unaligned_mode>(i, std::get<I>(batches)), ...);
                     }
+                };
+
+                if (policy.use_parallel(size, cost()))
+                {
+                    parallel_for(
+                        policy,
+                        size_type(0),
+                        align_end / simd_size,
+                        [&assign_batches](size_type first, size_type last)
+                        {
+                            assign_batches(first * simd_size, last * simd_size);
+                        },
+                        policy.grain_size(cost() * simd_size)
+                    );
                 }
                 else
                 {
-                    for (std::size_t i = 0; i < idx.size(); ++i)
+                    assign_batches(size_type(0), align_end);
+                }
+
+                for (size_type i = align_end; i < size; ++i)
+                {
+                    auto values = std::make_tuple(
+                        conditional_cast<needs_cast<I>(), output_value_t<I>>(std::get<I>(e).data_element(i)
+                        )...
+                    );
+                    ((std::get<I>(o).data_element(i) = std::get<I>(values)), ...);
+                }
+            }
+
+            static void run_linear(output_tuple& o, const expression_tuple& e, const execution_policy& policy)
+            {
+                using size_type = std::size_t;
+                size_type size = static_cast<size_type>(std::get<0>(o).size());
+
+                auto assign_range = [&o, &e](size_type first, size_type last)
+                {
+                    std::ptrdiff_t offset = static_cast<std::ptrdiff_t>(first);
+                    auto src = std::make_tuple((linear_begin(std::get<I>(e)) + offset)...);
+                    auto dst = std::make_tuple((linear_begin(std::get<I>(o)) + offset)...);
+                    for (size_type i = first; i < last; ++i)
                     {
-                        fct_stepper.step(i + step_dim, idx[i]);
+                        auto values = std::make_tuple(
+                            conditional_cast<needs_cast<I>(), output_value_t<I>>(*std::get<I>(src))...
+                        );
+                        ((*std::get<I>(dst) = std::get<I>(values)), ...);
+                        (++std::get<I>(src), ...);
+                        (++std::get<I>(dst), ...);
                     }
+                };
+
+                if (policy.use_parallel(size, cost()))
+                {
+                    parallel_for(policy, size_type(0), size, assign_range, policy.grain_size(cost()));
+                }
+                else
+                {
+                    assign_range(size_type(0), size);
                 }
             }
-#if (defined(XTENSOR_USE_OPENMP) || defined(XTENSOR_USE_TBB)) && defined(strided_parallel_assign)
-        }
-#endif
-    }
 
-    template <>
-    template <class E1, class E2>
-    inline void strided_loop_assigner<true>::run(E1& e1, const E2& e2)
-    {
-        strided_assign_detail::loop_sizes_t loop_sizes = strided_loop_assigner<true>::get_loop_sizes(e1, e2);
-        if (loop_sizes.can_do_strided_assign)
-        {
-            run(e1, e2, loop_sizes);
-        }
-        else
-        {
-            // trigger the fallback assigner
-            stepper_assigner<E1, E2, default_assignable_layout(E1::static_layout)>(e1, e2).run();
-        }
+            static void run_stepper(output_tuple& o, const expression_tuple& e)
+            {
+                using first_output = output_t<0>;
+                using index_type = xindex_type_t<typename first_output::shape_type>;
+                using size_type = typename first_output::size_type;
+                constexpr layout_type L = default_assignable_layout(first_output::static_layout);
+
+                const auto& shape = std::get<0>(o).shape();
+                multi_stepper<typename O::stepper..., typename E::const_stepper...> st(
+                    std::get<I>(o).stepper_begin(shape)...,
+                    std::get<I>(e).stepper_begin(shape)...
+                );
+                index_type index = xtl::make_sequence<index_type>(shape.size(), size_type(0));
+
+                size_type size = std::get<0>(o).size();
+                for (size_type i = 0; i < size; ++i)
+                {
+                    auto values = std::make_tuple(
+                        conditional_cast<needs_cast<I>(), output_value_t<I>>(
+                            *std::get<nb_outputs + I>(st.m_steppers)
+                        )...
+                    );
+                    ((*std::get<I>(st.m_steppers) = std::get<I>(values)), ...);
+                    stepper_tools<L>::increment_stepper(st, index, shape);
+                }
+            }
+
+            static void
+            run_separate(output_tuple& o, const expression_tuple& e, const execution_policy& policy)
+            {
+                // The results do not share an index space, evaluate them all before
+                // assigning any of them to keep the semantic of the fused traversal.
+                // The outputs have already been resized, and the temporaries are not
+                // broadcasting expressions.
+                std::tuple<temporary_type_t<E>...> tmp(std::get<I>(e)...);
+                (xt::assign_data(std::get<I>(o), std::get<I>(tmp), true, policy), ...);
+            }
+        };
     }
 
-    template <>
-    template <class E1, class E2>
-    inline void strided_loop_assigner<false>::run(E1& /*e1*/, const E2& /*e2*/, const loop_sizes_t&)
+    /**
+     * @brief Assigns several expressions to several outputs in a single traversal.
+     *
+     * The operands shared by the expressions are read once per index instead of once
+     * per expression, which saves memory bandwidth:
+     *
+     * @code{.cpp}
+     * xt::xarray<double> s, d;
+     * xt::assign_all(std::tie(s, d), x + y, x - y);
+     * @endcode
+     *
+     * Every output is resized to the shape of its expression. All the expressions are
+     * evaluated at a given index before any output is written, so an output may appear
+     * in the expressions as long as it is read at the same index; as with noalias, reading
+     * an output at other indices (e.g. through a shifted view) gives unspecified results.
+     * Outputs of different shapes are assigned one after the other, through temporaries.
+     *
+     * @param e1 a tuple of references to the outputs, e.g. made with ``std::tie``
+     * @param e2 the expressions, one per output
+     */
+    template <class... E1, class... E2>
+    inline void assign_all(std::tuple<E1&...> e1, const xexpression<E2>&... e2)
     {
+        assign_all(e1, execution::default_policy, e2...);
     }
 
-    template <>
-    template <class E1, class E2>
-    inline void strided_loop_assigner<false>::run(E1& e1, const E2& e2)
+    /**
+     * @brief Assigns several expressions to several outputs in a single traversal,
+     * with the given execution policy.
+     *
+     * @param e1 a tuple of references to the outputs, e.g. made with ``std::tie``
+     * @param policy the execution policy, e.g. \c xt::seq or \c xt::par.
+     * @param e2 the expressions, one per output
+     */
+    template <class... E1, class... E2>
+    inline void
+    assign_all(std::tuple<E1&...> e1, const execution_policy& policy, const xexpression<E2>&... e2)
     {
-        // trigger the fallback assigner
-        stepper_assigner<E1, E2, default_assignable_layout(E1::static_layout)>(e1, e2).run();
+        static_assert(sizeof...(E1) == sizeof...(E2), "assign_all requires one expression per output");
+        static_assert(sizeof...(E1) != 0, "assign_all requires at least one output");
+        using assigner_type = detail::multi_assigner<std::tuple<E1&...>, std::tuple<const E2&...>>;
+        assigner_type::run(e1, std::tuple<const E2&...>(e2.derived_cast()...), policy);
     }
 }
 
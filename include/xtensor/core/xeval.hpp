@@ -10,6 +10,8 @@
 #ifndef XTENSOR_EVAL_HPP
 #define XTENSOR_EVAL_HPP
 
+#include "../core/xassign.hpp"
+#include "../core/xexecution.hpp"
 #include "../core/xexpression_traits.hpp"
 #include "../core/xshape.hpp"
 #include "../core/xtensor_forward.hpp"
@@ -58,6 +60,38 @@ namespace xt
 
     /// @endcond
 
+    /**
+     * Force evaluation of xexpression, running the assignment loop with the
+     * execution policy \c policy.
+     *
+     * @code{.cpp}
+     * xt::xarray<double> a = {1, 2, 3, 4};
+     * auto&& b = xt::eval(a, xt::par); // b is a reference to a, no copy!
+     * auto&& c = xt::eval(xt::exp(a), xt::par); // c is xarray<double>, evaluated in parallel
+     * @endcode
+     *
+     * @ingroup xt_xeval
+     * @return xt::xarray or xt::xtensor depending on shape type
+     */
+    template <class T>
+    inline auto eval(T&& t, const execution_policy& /*policy*/)
+        -> std::enable_if_t<detail::is_container<std::decay_t<T>>::value, T&&>
+    {
+        return std::forward<T>(t);
+    }
+
+    /// @cond DOXYGEN_INCLUDE_SFINAE
+    template <class T>
+    inline auto eval(T&& t, const execution_policy& policy)
+        -> std::enable_if_t<!detail::is_container<std::decay_t<T>>::value, temporary_type_t<T>>
+    {
+        temporary_type_t<T> res;
+        xt::assign_xexpression(res, t, policy);
+        return res;
+    }
+
+    /// @endcond
+
     namespace detail
     {
         /**********************************
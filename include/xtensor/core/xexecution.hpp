@@ -0,0 +1,698 @@
+/***************************************************************************
+ * Copyright (c) Johan Mabille, Sylvain Corlay and Wolf Vollprecht          *
+ * Copyright (c) QuantStack                                                 *
+ *                                                                          *
+ * Distributed under the terms of the BSD 3-Clause License.                 *
+ *                                                                          *
+ * The full license is in the file LICENSE, distributed with this software. *
+ ****************************************************************************/
+
+#ifndef XTENSOR_EXECUTION_HPP
+#define XTENSOR_EXECUTION_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "../core/xtensor_config.hpp"
+#include "../utils/xthread_pool.hpp"
+
+#if defined(XTENSOR_USE_TBB)
+#include <tbb/tbb.h>
+#endif
+
+#if defined(XTENSOR_USE_OPENMP)
+#include <omp.h>
+#endif
+
+namespace xt
+{
+    /**
+     * @defgroup xt_xexecution Execution policies
+     *
+     * Execution policies select, for each call, whether an assignment loop runs
+     * on the calling thread or is split across several threads, and which
+     * threading backend is used for that.
+     *
+     * @code{.cpp}
+     * xt::noalias(small) = a + b;                  // default policy
+     * xt::noalias(small).assign(a + b, xt::seq);   // always single-threaded
+     * xt::noalias(large).assign(a + b, xt::par);   // best available backend
+     * auto res = xt::eval(xt::exp(large), xt::par);
+     * xt::noalias(huge).assign(a * 2., xt::streaming);  // bypasses the cache
+     * @endcode
+     */
+
+    /**
+     * @ingroup xt_xexecution
+     * Backends used to run parallel loops.
+     */
+    enum class execution_backend
+    {
+        /// Runs on the calling thread.
+        sequential,
+        /// Runs on the best available backend: TBB, then OpenMP, then native threads.
+        parallel,
+        /// Runs with Intel TBB, requires ``XTENSOR_USE_TBB``.
+        tbb,
+        /// Runs with OpenMP, requires ``XTENSOR_USE_OPENMP``.
+        openmp,
+        /// Runs on the workers of ``xt::thread_pool::global()``, always available.
+        threads
+    };
+
+    /**
+     * @ingroup xt_xexecution
+     * @brief Parameters deciding whether a loop is worth running in parallel.
+     *
+     * The work of a loop is its number of elements times the estimated cost of
+     * one element (see expression_cost), in units of roughly one load or one
+     * addition. Loops with less than ``min_work`` run sequentially, and
+     * parallel loops are split in chunks of at least ``min_chunk_work``.
+     */
+    struct parallel_cost_model
+    {
+        std::size_t min_work = XTENSOR_PARALLEL_MIN_WORK;
+        std::size_t min_chunk_work = XTENSOR_PARALLEL_MIN_CHUNK_WORK;
+    };
+
+    /**
+     * @class execution_policy
+     * @ingroup xt_xexecution
+     * @brief Runtime selection of the backend used by assignment loops.
+     *
+     * Policies are regular values, so they can be chosen at runtime, e.g.
+     * ``auto p = a.size() > n ? xt::par : xt::seq``. Requesting a backend
+     * which is not compiled in falls back to the best available one.
+     *
+     * A policy can also request non-temporal (streaming) stores, which write
+     * the destination of contiguous assignments without loading it in the cache
+     * first, see ``xt::streaming`` and ``XTENSOR_STREAMING_STORE_THRESHOLD``.
+     */
+    class execution_policy
+    {
+    public:
+
+        constexpr explicit execution_policy(execution_backend backend, bool streaming = false) noexcept;
+
+        constexpr execution_backend backend() const noexcept;
+        constexpr execution_backend resolved_backend() const noexcept;
+
+        constexpr bool streaming() const noexcept;
+        constexpr execution_policy with_streaming(bool streaming = true) const noexcept;
+        constexpr bool use_streaming(std::size_t nb_bytes) const noexcept;
+
+        constexpr bool is_parallel() const noexcept;
+        constexpr bool use_parallel(std::size_t size) const noexcept;
+        bool use_parallel(std::size_t size, std::size_t cost) const noexcept;
+        std::size_t grain_size(std::size_t cost) const noexcept;
+
+        std::size_t concurrency() const;
+
+    private:
+
+        execution_backend m_backend;
+        bool m_streaming;
+    };
+
+    constexpr bool operator==(const execution_policy& lhs, const execution_policy& rhs) noexcept;
+    constexpr bool operator!=(const execution_policy& lhs, const execution_policy& rhs) noexcept;
+
+    /***********************************
+     * execution_policy implementation *
+     ***********************************/
+
+    constexpr execution_policy::execution_policy(execution_backend backend, bool streaming) noexcept
+        : m_backend(backend)
+        , m_streaming(streaming)
+    {
+    }
+
+    /**
+     * Returns the backend requested when building the policy.
+     */
+    constexpr execution_backend execution_policy::backend() const noexcept
+    {
+        return m_backend;
+    }
+
+    /**
+     * Returns the backend that is actually used, i.e. the requested one
+     * if it is available, the best available backend otherwise.
+     */
+    constexpr execution_backend execution_policy::resolved_backend() const noexcept
+    {
+        switch (m_backend)
+        {
+            case execution_backend::sequential:
+            case execution_backend::threads:
+                return m_backend;
+#if defined(XTENSOR_USE_TBB)
+            case execution_backend::tbb:
+                return execution_backend::tbb;
+#endif
+#if defined(XTENSOR_USE_OPENMP)
+            case execution_backend::openmp:
+                return execution_backend::openmp;
+#endif
+            default:
+#if defined(XTENSOR_USE_TBB)
+                return execution_backend::tbb;
+#elif defined(XTENSOR_USE_OPENMP)
+                return execution_backend::openmp;
+#else
+                return execution_backend::threads;
+#endif
+        }
+    }
+
+    /**
+     * Returns true if the policy requests non-temporal stores.
+     */
+    constexpr bool execution_policy::streaming() const noexcept
+    {
+        return m_streaming;
+    }
+
+    /**
+     * Returns a policy with the same backend, which requests non-temporal
+     * stores if \p streaming is true.
+     */
+    constexpr execution_policy execution_policy::with_streaming(bool streaming) const noexcept
+    {
+        return execution_policy(m_backend, streaming);
+    }
+
+    /**
+     * Returns true if an assignment writing \p nb_bytes contiguous bytes should
+     * use non-temporal stores, i.e. if the policy requests them or if \p nb_bytes
+     * reaches ``XTENSOR_STREAMING_STORE_THRESHOLD``.
+     */
+    constexpr bool execution_policy::use_streaming(std::size_t nb_bytes) const noexcept
+    {
+        std::size_t threshold = XTENSOR_STREAMING_STORE_THRESHOLD;
+        return m_streaming || (threshold != 0 && nb_bytes >= threshold);
+    }
+
+    /**
+     * Returns true if the policy may split loops across several threads.
+     */
+    constexpr bool execution_policy::is_parallel() const noexcept
+    {
+        return m_backend != execution_backend::sequential;
+    }
+
+    /**
+     * Returns true if a loop over \p size elements should run in parallel, i.e.
+     * if the policy is parallel and \p size reaches the threshold of its backend
+     * (``XTENSOR_TBB_THRESHOLD``, ``XTENSOR_OPENMP_TRESHOLD`` or
+     * ``XTENSOR_THREADS_THRESHOLD``).
+     */
+    constexpr bool execution_policy::use_parallel(std::size_t size) const noexcept
+    {
+        // Comparing size with a literal zero threshold would trigger -Wtype-limits
+        std::size_t threshold = 0;
+        switch (resolved_backend())
+        {
+            case execution_backend::tbb:
+                threshold = XTENSOR_TBB_THRESHOLD;
+                break;
+            case execution_backend::openmp:
+                threshold = XTENSOR_OPENMP_TRESHOLD;
+                break;
+            case execution_backend::threads:
+                threshold = XTENSOR_THREADS_THRESHOLD;
+                break;
+            default:
+                return false;
+        }
+        return size >= threshold;
+    }
+
+    constexpr bool operator==(const execution_policy& lhs, const execution_policy& rhs) noexcept
+    {
+        return lhs.backend() == rhs.backend() && lhs.streaming() == rhs.streaming();
+    }
+
+    constexpr bool operator!=(const execution_policy& lhs, const execution_policy& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    /*********************
+     * standard policies *
+     *********************/
+
+    namespace execution
+    {
+        inline constexpr execution_policy seq{execution_backend::sequential};
+        inline constexpr execution_policy par{execution_backend::parallel};
+        inline constexpr execution_policy par_tbb{execution_backend::tbb};
+        inline constexpr execution_policy par_openmp{execution_backend::openmp};
+        inline constexpr execution_policy par_threads{execution_backend::threads};
+
+        /// Policy used when none is passed explicitly, see ``XTENSOR_DEFAULT_EXECUTION``.
+        inline constexpr execution_policy default_policy{XTENSOR_DEFAULT_EXECUTION};
+
+        /// Default policy with non-temporal stores.
+        inline constexpr execution_policy streaming{XTENSOR_DEFAULT_EXECUTION, true};
+    }
+
+    using execution::par;
+    using execution::seq;
+    using execution::streaming;
+
+    parallel_cost_model get_parallel_cost_model() noexcept;
+    void set_parallel_cost_model(const parallel_cost_model& model) noexcept;
+    parallel_cost_model calibrate_parallel_cost_model(const execution_policy& policy = execution::par);
+
+    namespace detail
+    {
+        template <class F>
+        void parallel_for(
+            const execution_policy& policy,
+            std::size_t first,
+            std::size_t last,
+            F&& f,
+            std::size_t grain = 1
+        );
+
+        template <class T, class F, class M>
+        T parallel_reduce(
+            const execution_policy& policy,
+            std::size_t first,
+            std::size_t last,
+            F&& f,
+            M&& merge,
+            std::size_t grain = 1
+        );
+    }
+
+    template <class T>
+    void first_touch(T* data, std::size_t size, const execution_policy& policy = execution::default_policy);
+
+    template <class E>
+    auto first_touch(E& e, const execution_policy& policy = execution::default_policy)
+        -> decltype(e.data(), void());
+
+    /**************************************
+     * parallel_cost_model implementation *
+     **************************************/
+
+    namespace detail
+    {
+        struct parallel_cost_model_storage
+        {
+            explicit parallel_cost_model_storage(const parallel_cost_model& model) noexcept
+                : min_work(model.min_work)
+                , min_chunk_work(model.min_chunk_work)
+            {
+            }
+
+            std::atomic<std::size_t> min_work;
+            std::atomic<std::size_t> min_chunk_work;
+        };
+
+        inline parallel_cost_model measure_parallel_cost_model(const execution_policy& policy);
+
+        inline parallel_cost_model_storage& parallel_cost_model_instance()
+        {
+#if defined(XTENSOR_CALIBRATE_PARALLEL_COST_MODEL)
+            static parallel_cost_model_storage storage(measure_parallel_cost_model(execution::par));
+#else
+            static parallel_cost_model_storage storage((parallel_cost_model()));
+#endif
+            return storage;
+        }
+
+        inline std::size_t saturated_product(std::size_t a, std::size_t b) noexcept
+        {
+            return (b != 0 && a > std::numeric_limits<std::size_t>::max() / b)
+                       ? std::numeric_limits<std::size_t>::max()
+                       : a * b;
+        }
+
+        /**
+         * Measures the overhead of a parallel loop on the backend of the policy, and
+         * the time of one unit of work, and derives the work above which parallel
+         * loops pay off.
+         */
+        inline parallel_cost_model measure_parallel_cost_model(const execution_policy& policy)
+        {
+            using clock_type = std::chrono::steady_clock;
+            using duration_type = std::chrono::duration<double>;
+            constexpr std::size_t max_work = std::numeric_limits<std::size_t>::max();
+
+            std::size_t nb_threads = policy.concurrency();
+            if (nb_threads < 2)
+            {
+                return parallel_cost_model{max_work, max_work};
+            }
+
+            constexpr std::size_t nb_repeats = 8;
+            constexpr std::size_t nb_dispatches = 16;
+            std::vector<std::size_t> touched(nb_threads, 0);
+            double dispatch_time = std::numeric_limits<double>::max();
+            for (std::size_t r = 0; r < nb_repeats; ++r)
+            {
+                auto start = clock_type::now();
+                for (std::size_t d = 0; d < nb_dispatches; ++d)
+                {
+                    parallel_for(
+                        policy,
+                        std::size_t(0),
+                        nb_threads,
+                        [&touched](std::size_t first, std::size_t last)
+                        {
+                            for (std::size_t i = first; i < last; ++i)
+                            {
+                                ++touched[i];
+                            }
+                        }
+                    );
+                }
+                duration_type elapsed = clock_type::now() - start;
+                dispatch_time = std::min(dispatch_time, elapsed.count() / double(nb_dispatches));
+            }
+
+            // res = a + res costs 4 units per element: 2 loads, 1 addition, 1 store.
+            constexpr std::size_t size = std::size_t(1) << 16;
+            constexpr std::size_t unit_per_element = 4;
+            std::vector<double> a(size, 1.), res(size, 0.);
+            double unit_time = std::numeric_limits<double>::max();
+            for (std::size_t r = 0; r < nb_repeats; ++r)
+            {
+                auto start = clock_type::now();
+                for (std::size_t i = 0; i < size; ++i)
+                {
+                    res[i] = a[i] + res[i];
+                }
+                duration_type elapsed = clock_type::now() - start;
+                unit_time = std::min(unit_time, elapsed.count() / double(size * unit_per_element));
+            }
+            // Keeps the measured loop alive
+            volatile double sink = res[size / 2] + double(touched[0]);
+            static_cast<void>(sink);
+
+            if (!(unit_time > 0.))
+            {
+                return parallel_cost_model{};
+            }
+
+            // A loop of work w takes w * unit_time sequentially, and roughly
+            // w * unit_time / nb_threads + dispatch_time in parallel. Going parallel
+            // is required to save at least the dispatch time.
+            double speedup_ratio = 1. - 1. / double(nb_threads);
+            double min_work = 2. * dispatch_time / (unit_time * speedup_ratio);
+            parallel_cost_model model;
+            model.min_work = min_work >= double(max_work) ? max_work : static_cast<std::size_t>(min_work) + 1;
+            model.min_chunk_work = std::max(
+                std::size_t(1),
+                model.min_work / (thread_pool::chunks_per_thread * nb_threads)
+            );
+            return model;
+        }
+    }
+
+    /**
+     * @ingroup xt_xexecution
+     * Returns the cost model used to decide whether loops run in parallel.
+     */
+    inline parallel_cost_model get_parallel_cost_model() noexcept
+    {
+        auto& storage = detail::parallel_cost_model_instance();
+        return parallel_cost_model{storage.min_work.load(), storage.min_chunk_work.load()};
+    }
+
+    /**
+     * @ingroup xt_xexecution
+     * Sets the cost model used to decide whether loops run in parallel.
+     * ``set_parallel_cost_model({0, 1})`` runs every loop of a parallel
+     * policy in parallel, regardless of its size.
+     */
+    inline void set_parallel_cost_model(const parallel_cost_model& model) noexcept
+    {
+        auto& storage = detail::parallel_cost_model_instance();
+        storage.min_work.store(model.min_work);
+        storage.min_chunk_work.store(std::max(model.min_chunk_work, std::size_t(1)));
+    }
+
+    /**
+     * @ingroup xt_xexecution
+     * Measures the overhead of parallel loops on the backend of \p policy
+     * and the throughput of a simple loop on this machine, sets the cost model
+     * accordingly and returns it. The measure takes a few milliseconds; it is
+     * done once at startup when ``XTENSOR_CALIBRATE_PARALLEL_COST_MODEL`` is
+     * defined.
+     */
+    inline parallel_cost_model calibrate_parallel_cost_model(const execution_policy& policy)
+    {
+        parallel_cost_model model = detail::measure_parallel_cost_model(policy);
+        set_parallel_cost_model(model);
+        return model;
+    }
+
+    /**
+     * Returns true if a loop over \p size elements costing \p cost each should
+     * run in parallel, i.e. if the policy is parallel, \p size reaches the threshold
+     * of its backend and the work of the loop reaches the minimum work of the
+     * parallel cost model.
+     */
+    inline bool execution_policy::use_parallel(std::size_t size, std::size_t cost) const noexcept
+    {
+        return use_parallel(size)
+               && detail::saturated_product(size, cost) >= get_parallel_cost_model().min_work;
+    }
+
+    /**
+     * Returns the minimum number of elements costing \p cost each in a chunk
+     * of a parallel loop.
+     */
+    inline std::size_t execution_policy::grain_size(std::size_t cost) const noexcept
+    {
+        std::size_t min_chunk_work = get_parallel_cost_model().min_chunk_work;
+        cost = std::max(cost, std::size_t(1));
+        return std::max((min_chunk_work + cost - 1) / cost, std::size_t(1));
+    }
+
+    /**
+     * Returns the number of threads running the loops of the policy.
+     */
+    inline std::size_t execution_policy::concurrency() const
+    {
+        switch (resolved_backend())
+        {
+#if defined(XTENSOR_USE_TBB)
+            case execution_backend::tbb:
+                return static_cast<std::size_t>(tbb::this_task_arena::max_concurrency());
+#endif
+#if defined(XTENSOR_USE_OPENMP)
+            case execution_backend::openmp:
+                return static_cast<std::size_t>(omp_get_max_threads());
+#endif
+            case execution_backend::threads:
+                return thread_pool::global().size();
+            default:
+                return 1;
+        }
+    }
+
+    /*******************************
+     * parallel_for implementation *
+     *******************************/
+
+    namespace detail
+    {
+        /**
+         * Splits [first, last) in contiguous chunks of at least \p grain indices and
+         * calls f(chunk_first, chunk_last) on each of them with the backend of the
+         * policy. The chunks are initially distributed the same way by consecutive
+         * calls with the same range and policy.
+         */
+        template <class F>
+        inline void parallel_for(
+            const execution_policy& policy,
+            std::size_t first,
+            std::size_t last,
+            F&& f,
+            std::size_t grain
+        )
+        {
+            if (first >= last)
+            {
+                return;
+            }
+            std::size_t size = last - first;
+            grain = std::max(grain, std::size_t(1));
+            if (size < 2 * grain)
+            {
+                f(first, last);
+                return;
+            }
+
+            switch (policy.resolved_backend())
+            {
+#if defined(XTENSOR_USE_TBB)
+                case execution_backend::tbb:
+                {
+                    tbb::static_partitioner sp;
+                    tbb::parallel_for(
+                        tbb::blocked_range<std::size_t>(first, last, grain),
+                        [&f](const tbb::blocked_range<std::size_t>& r)
+                        {
+                            f(r.begin(), r.end());
+                        },
+                        sp
+                    );
+                    break;
+                }
+#endif
+#if defined(XTENSOR_USE_OPENMP)
+                case execution_backend::openmp:
+                {
+                    int nb_threads = static_cast<int>(
+                        std::min(static_cast<std::size_t>(omp_get_max_threads()), size / grain)
+                    );
+#pragma omp parallel num_threads(nb_threads) default(none) shared(f, first, size)
+                    {
+                        std::size_t nb_chunks = static_cast<std::size_t>(omp_get_num_threads());
+                        std::size_t i = static_cast<std::size_t>(omp_get_thread_num());
+                        std::size_t chunk_first = first + size * i / nb_chunks;
+                        std::size_t chunk_last = first + size * (i + 1) / nb_chunks;
+                        if (chunk_first < chunk_last)
+                        {
+                            f(chunk_first, chunk_last);
+                        }
+                    }
+                    break;
+                }
+#endif
+                case execution_backend::threads:
+                {
+                    thread_pool::global().parallel_for(first, last, f, grain);
+                    break;
+                }
+                default:
+                {
+                    f(first, last);
+                    break;
+                }
+            }
+        }
+
+        /**
+         * Splits [first, last) in at most one chunk per thread of the policy, of at
+         * least \p grain indices, computes the partial results f(chunk_first, chunk_last)
+         * in parallel and folds them with merge(lhs, rhs) in the order of the chunks.
+         * The chunks only depend on the range, the grain and the number of threads,
+         * so that the result of a given reduction is reproducible.
+         */
+        template <class T, class F, class M>
+        inline T parallel_reduce(
+            const execution_policy& policy,
+            std::size_t first,
+            std::size_t last,
+            F&& f,
+            M&& merge,
+            std::size_t grain
+        )
+        {
+            std::size_t size = last > first ? last - first : std::size_t(0);
+            std::size_t nb_chunks = std::min(policy.concurrency(), size / std::max(grain, std::size_t(1)));
+            if (nb_chunks < 2)
+            {
+                return f(first, last);
+            }
+
+            std::vector<std::optional<T>> partials(nb_chunks);
+            parallel_for(
+                policy,
+                std::size_t(0),
+                nb_chunks,
+                [&](std::size_t chunk_first, std::size_t chunk_last)
+                {
+                    for (std::size_t i = chunk_first; i < chunk_last; ++i)
+                    {
+                        const std::size_t chunk_begin = first + size * i / nb_chunks;
+                        const std::size_t chunk_end = first + size * (i + 1) / nb_chunks;
+                        partials[i].emplace(f(chunk_begin, chunk_end));
+                    }
+                }
+            );
+
+            T res = std::move(*partials[0]);
+            for (std::size_t i = 1; i < nb_chunks; ++i)
+            {
+                res = merge(std::move(res), std::move(*partials[i]));
+            }
+            return res;
+        }
+    }
+
+    /******************************
+     * first_touch implementation *
+     ******************************/
+
+    /**
+     * @ingroup xt_xexecution
+     * @brief Touches the memory pages of a buffer from the threads that assign it.
+     *
+     * Operating systems usually map a page on the NUMA node of the thread that
+     * writes it first. This touches every page of the \p size elements starting
+     * at \p data from the thread to which the parallel loops of \p policy give
+     * this part of the buffer, so that parallel assignments to the buffer then
+     * access local memory. The content of the buffer is left unchanged; the call
+     * only places the pages that have not been touched yet.
+     *
+     * Large buffers of ``xt::uvector`` are touched this way on allocation when
+     * ``XTENSOR_FIRST_TOUCH_THRESHOLD`` is set.
+     */
+    template <class T>
+    inline void first_touch(T* data, std::size_t size, const execution_policy& policy)
+    {
+        constexpr std::size_t page_size = XTENSOR_PAGE_SIZE;
+        if (size == 0 || !policy.use_parallel(size, 1))
+        {
+            return;
+        }
+        // Loops over elements are split the same way whatever their grain,
+        // as long as they have enough chunks for all the threads.
+        std::size_t page_elements = std::max(page_size / sizeof(T), std::size_t(1));
+        auto touch_pages = [data](std::size_t first, std::size_t last)
+        {
+            auto* p = reinterpret_cast<volatile unsigned char*>(data + first);
+            auto* end = reinterpret_cast<volatile unsigned char*>(data + last);
+            while (p < end)
+            {
+                *p = *p;
+                p += page_size - reinterpret_cast<std::uintptr_t>(p) % page_size;
+            }
+        };
+        detail::parallel_for(policy, std::size_t(0), size, touch_pages, page_elements);
+    }
+
+    /**
+     * @ingroup xt_xexecution
+     * Touches the memory pages of the buffer of the container \p e from the
+     * threads that assign it with \p policy, see first_touch(T*, std::size_t, const execution_policy&).
+     * This is typically called right after building an uninitialized container:
+     *
+     * @code{.cpp}
+     * auto a = xt::xtensor<double, 2>::from_shape({n, m});
+     * xt::first_touch(a, xt::par);
+     * @endcode
+     */
+    template <class E>
+    inline auto first_touch(E& e, const execution_policy& policy) -> decltype(e.data(), void())
+    {
+        first_touch(e.data(), static_cast<std::size_t>(e.storage().size()), policy);
+    }
+}
+
+#endif
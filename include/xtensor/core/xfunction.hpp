@@ -79,10 +79,25 @@ namespace xt
         constexpr bool xfunction_cache_impl<fixed_shape<N...>, is_shape_trivial>::is_initialized;
 #endif
 
+        // Bool load types that cannot be added, such as the states of some reducers,
+        // do not take part in the promotion
+        template <class T, class = void>
+        struct promotable_bool_load_type
+        {
+            using type = bool;
+        };
+
+        template <class T>
+        struct promotable_bool_load_type<T, std::void_t<decltype(std::declval<T>() + std::declval<T>())>>
+        {
+            using type = T;
+        };
+
         template <class... CT>
         struct xfunction_bool_load_type
         {
-            using type = xtl::promote_type_t<typename std::decay_t<CT>::bool_load_type...>;
+            using type = xtl::promote_type_t<
+                typename promotable_bool_load_type<typename std::decay_t<CT>::bool_load_type>::type...>;
         };
 
         template <class CT>
@@ -134,6 +149,56 @@ namespace xt
     template <class F, class... CT>
     class xfunction;
 
+    /*************************
+     * xfunction cost model *
+     *************************/
+
+    /**
+     * @brief Estimated cost of one call to the functor \c F.
+     *
+     * The cost is expressed in units of roughly one load or one addition.
+     * Assignment loops use it to decide whether an expression is worth
+     * evaluating in parallel. Specialize it for functors which are much
+     * more expensive than an addition.
+     */
+    template <class F>
+    struct functor_cost : std::integral_constant<std::size_t, 1>
+    {
+    };
+
+    /**
+     * @brief Estimated cost of computing one element of the expression \c E,
+     * in the units of functor_cost.
+     */
+    template <class E>
+    struct expression_cost : std::integral_constant<std::size_t, 1>
+    {
+    };
+
+    template <class F, class... CT>
+    struct expression_cost<xfunction<F, CT...>>
+        : std::integral_constant<
+              std::size_t,
+              (functor_cost<F>::value + ... + expression_cost<std::decay_t<CT>>::value)>
+    {
+    };
+
+    template <class CT>
+    struct expression_cost<xscalar<CT>> : std::integral_constant<std::size_t, 0>
+    {
+    };
+
+    /**
+     * @brief Estimated cost of computing one element of \p e, in the units of
+     * functor_cost. It is expression_cost<E> unless overloaded for expressions
+     * whose elements cost depends on their shape, such as reducers.
+     */
+    template <class E>
+    inline std::size_t element_cost(const E&) noexcept
+    {
+        return expression_cost<E>::value;
+    }
+
     template <class F, class... CT>
     struct xiterable_inner_types<xfunction<F, CT...>>
     {
@@ -347,6 +347,49 @@ namespace xt
 #undef XTENSOR_UNARY_MATH_FUNCTOR_COMPLEX_REDUCING
 #undef XTENSOR_UNSIGNED_ABS_FUNC
 
+    // Costs of the math functors relative to an addition, see functor_cost.
+    // Functors which are not listed here cost about as much as an addition.
+
+#define XTENSOR_MATH_FUNCTOR_COST(NAME, COST)                                         \
+    template <>                                                                       \
+    struct functor_cost<math::NAME##_fun> : std::integral_constant<std::size_t, COST> \
+    {                                                                                 \
+    }
+
+    XTENSOR_MATH_FUNCTOR_COST(fmod, 8);
+    XTENSOR_MATH_FUNCTOR_COST(remainder, 8);
+    XTENSOR_MATH_FUNCTOR_COST(fma, 2);
+    XTENSOR_MATH_FUNCTOR_COST(sqrt, 4);
+    XTENSOR_MATH_FUNCTOR_COST(cbrt, 16);
+    XTENSOR_MATH_FUNCTOR_COST(hypot, 8);
+    XTENSOR_MATH_FUNCTOR_COST(exp, 16);
+    XTENSOR_MATH_FUNCTOR_COST(exp2, 16);
+    XTENSOR_MATH_FUNCTOR_COST(expm1, 16);
+    XTENSOR_MATH_FUNCTOR_COST(log, 16);
+    XTENSOR_MATH_FUNCTOR_COST(log10, 16);
+    XTENSOR_MATH_FUNCTOR_COST(log2, 16);
+    XTENSOR_MATH_FUNCTOR_COST(log1p, 16);
+    XTENSOR_MATH_FUNCTOR_COST(sin, 16);
+    XTENSOR_MATH_FUNCTOR_COST(cos, 16);
+    XTENSOR_MATH_FUNCTOR_COST(tan, 16);
+    XTENSOR_MATH_FUNCTOR_COST(asin, 16);
+    XTENSOR_MATH_FUNCTOR_COST(acos, 16);
+    XTENSOR_MATH_FUNCTOR_COST(atan, 16);
+    XTENSOR_MATH_FUNCTOR_COST(sinh, 16);
+    XTENSOR_MATH_FUNCTOR_COST(cosh, 16);
+    XTENSOR_MATH_FUNCTOR_COST(tanh, 16);
+    XTENSOR_MATH_FUNCTOR_COST(asinh, 16);
+    XTENSOR_MATH_FUNCTOR_COST(acosh, 16);
+    XTENSOR_MATH_FUNCTOR_COST(atanh, 16);
+    XTENSOR_MATH_FUNCTOR_COST(erf, 16);
+    XTENSOR_MATH_FUNCTOR_COST(erfc, 16);
+    XTENSOR_MATH_FUNCTOR_COST(pow, 32);
+    XTENSOR_MATH_FUNCTOR_COST(atan2, 32);
+    XTENSOR_MATH_FUNCTOR_COST(tgamma, 32);
+    XTENSOR_MATH_FUNCTOR_COST(lgamma, 32);
+
+#undef XTENSOR_MATH_FUNCTOR_COST
+
     namespace detail
     {
         template <class R, class T>
@@ -799,6 +842,16 @@ namespace xt
         std::numeric_limits<xvalue_type_t<std::decay_t<E>>>::max()
     )
 
+    template <class T>
+    struct is_associative_reducer<math::maximum<T>> : std::true_type
+    {
+    };
+
+    template <class T>
+    struct is_associative_reducer<math::minimum<T>> : std::true_type
+    {
+    };
+
     /**
      * @ingroup basic_functions
      * @brief Clip values between hi and lo
@@ -2057,6 +2110,192 @@ namespace xt
         {
             return make_xshared(std::move(e));
         }
+
+        /**
+         * Number of elements, mean and sum of the squared differences from the
+         * mean of a set of values, from which their variance is computed.
+         */
+        template <class T>
+        struct welford_state
+        {
+            std::size_t count;
+            T mean;
+            T m2;
+        };
+
+        // Merges the states of two sets of values (Chan et al.)
+        template <class T>
+        struct welford_merge
+        {
+            welford_state<T> operator()(const welford_state<T>& lhs, const welford_state<T>& rhs) const
+            {
+                if (rhs.count == 0)
+                {
+                    return lhs;
+                }
+                if (lhs.count == 0)
+                {
+                    return rhs;
+                }
+                std::size_t count = lhs.count + rhs.count;
+                T delta = rhs.mean - lhs.mean;
+                T rhs_ratio = static_cast<T>(rhs.count) / static_cast<T>(count);
+                return {
+                    count,
+                    lhs.mean + delta * rhs_ratio,
+                    lhs.m2 + rhs.m2 + delta * delta * static_cast<T>(lhs.count) * rhs_ratio
+                };
+            }
+        };
+
+        // Sum of f(x) over the n first values of a block, with independent accumulators
+        template <class T, std::size_t N, class F>
+        inline T unrolled_block_sum(const std::array<T, N>& block, std::size_t n, F f)
+        {
+            constexpr std::size_t nb_acc = 4;
+            std::array<T, nb_acc> acc = {};
+            std::size_t i = 0;
+            for (; i + nb_acc <= n; i += nb_acc)
+            {
+                for (std::size_t k = 0; k < nb_acc; ++k)
+                {
+                    acc[k] += f(block[i + k]);
+                }
+            }
+            for (; i < n; ++i)
+            {
+                acc[0] += f(block[i]);
+            }
+            return (acc[0] + acc[1]) + (acc[2] + acc[3]);
+        }
+
+        // State of the n first values of a block, computed in two passes
+        template <class T, std::size_t N>
+        inline welford_state<T> welford_block_state(const std::array<T, N>& block, std::size_t n, T sum)
+        {
+            T mean = sum / static_cast<T>(n);
+            T m2 = unrolled_block_sum(
+                block,
+                n,
+                [mean](T x)
+                {
+                    return (x - mean) * (x - mean);
+                }
+            );
+            return {n, mean, m2};
+        }
+
+        // Adds values to a state (Welford), ignoring NaN values if skip_nan is true
+        template <class T, bool skip_nan = false>
+        struct welford_reduce
+        {
+            template <class V>
+            welford_state<T> operator()(welford_state<T> s, const V& v) const
+            {
+                T x = static_cast<T>(v);
+                if constexpr (skip_nan)
+                {
+                    if (math::isnan(x))
+                    {
+                        return s;
+                    }
+                }
+                ++s.count;
+                T delta = x - s.mean;
+                s.mean += delta / static_cast<T>(s.count);
+                s.m2 += delta * (x - s.mean);
+                return s;
+            }
+
+            // Reduces blocks of consecutive values with two passes over a buffer in cache,
+            // which avoids a division per value, and merges their states
+            template <class It>
+            welford_state<T> reduce_range(welford_state<T> s, It first, It last) const
+            {
+                constexpr std::size_t block_size = 512;
+                std::array<T, block_size> block;
+                while (first != last)
+                {
+                    std::size_t n = 0;
+                    for (; n != block_size && first != last; ++first)
+                    {
+                        // NaN values are overwritten by the next value instead of branching
+                        block[n] = static_cast<T>(*first);
+                        n += (skip_nan && math::isnan(block[n])) ? 0 : 1;
+                    }
+                    T sum = unrolled_block_sum(
+                        block,
+                        n,
+                        [](T x)
+                        {
+                            return x;
+                        }
+                    );
+                    s = welford_merge<T>()(s, welford_block_state(block, n, sum));
+                }
+                return s;
+            }
+        };
+
+        template <class T>
+        struct welford_variance
+        {
+            T operator()(const welford_state<T>& s) const
+            {
+                return s.m2 / (static_cast<T>(s.count) - m_ddof);
+            }
+
+            T m_ddof;
+        };
+
+        // Variance computed in a single pass over e, args being the reducer axes and options
+        template <class T, bool skip_nan = false, class D, class E, class... A>
+        inline auto welford_variance_reducer(const D& ddof, E&& e, A&&... args)
+        {
+            using state_type = welford_state<T>;
+            auto reducer = xt::reduce(
+                make_xreducer_functor(
+                    welford_reduce<T, skip_nan>(),
+                    const_value<state_type>(state_type{0, T(0), T(0)}),
+                    welford_merge<T>()
+                ),
+                std::forward<E>(e),
+                std::forward<A>(args)...
+            );
+            return make_lambda_xfunction(welford_variance<T>{static_cast<T>(ddof)}, std::move(reducer));
+        }
+
+        // Variance computed from the mean in a second pass over e
+        template <class T, class E, class D, class EVS>
+        inline auto two_pass_variance(E&& e, const D& ddof, EVS es)
+        {
+            auto cached_mean = mean<T>(e, es)();
+            return detail::mean_noaxis<T>(square(std::forward<E>(e) - std::move(cached_mean)), ddof, es);
+        }
+
+        template <class T, class E, class X, class D, class EVS>
+        inline auto two_pass_variance(E&& e, X&& axes, const D& ddof, EVS es)
+        {
+            decltype(auto) sc = detail::shared_forward<E>(e);
+            // note: forcing copy of first axes argument -- is there a better solution?
+            auto axes_copy = axes;
+            // always eval to prevent repeated evaluations in the next calls
+            auto inner_mean = eval(mean<T>(sc, std::move(axes_copy), evaluation_strategy::immediate));
+
+            // fake keep_dims = 1
+            // Since the inner_shape might have a reference semantic (e.g. xbuffer_adaptor in bindings)
+            // We need to map it to another type before modifying it.
+            // We pragmatically abuse `get_strides_t`
+            using tmp_shape_t = get_strides_t<typename std::decay_t<E>::shape_type>;
+            tmp_shape_t keep_dim_shape = xtl::forward_sequence<tmp_shape_t, decltype(e.shape())>(e.shape());
+            for (const auto& el : axes)
+            {
+                keep_dim_shape[el] = 1u;
+            }
+
+            auto mrv = reshape_view<XTENSOR_DEFAULT_LAYOUT>(std::move(inner_mean), std::move(keep_dim_shape));
+            return detail::mean<T>(square(sc - std::move(mrv)), std::forward<X>(axes), ddof, es);
+        }
     }
 
     template <
@@ -2067,8 +2306,16 @@ namespace xt
         XTL_REQUIRES(is_reducer_options<EVS>, xtl::is_integral<D>)>
     inline auto variance(E&& e, const D& ddof, EVS es = EVS())
     {
-        auto cached_mean = mean<T>(e, es)();
-        return detail::mean_noaxis<T>(square(std::forward<E>(e) - std::move(cached_mean)), ddof, es);
+        using value_type = typename std::decay_t<
+            decltype(detail::two_pass_variance<T>(e, ddof, es))>::value_type;
+        if constexpr (std::is_floating_point<value_type>::value)
+        {
+            return detail::welford_variance_reducer<value_type>(ddof, std::forward<E>(e), es);
+        }
+        else
+        {
+            return detail::two_pass_variance<T>(std::forward<E>(e), ddof, es);
+        }
     }
 
     template <class T = void, class E, class EVS = DEFAULT_STRATEGY_REDUCERS, XTL_REQUIRES(is_reducer_options<EVS>)>
@@ -2089,7 +2336,10 @@ namespace xt
      *
      * Returns the variance of the array elements, a measure of the spread of a
      * distribution. The variance is computed for the flattened array by default,
-     * otherwise over the specified axes.
+     * otherwise over the specified axes. Floating point variances are computed
+     * in a single pass over the elements with Welford's algorithm, partial
+     * results of blocks of elements and of threads being merged with the
+     * formula of Chan et al.
      *
      * Note: this function is not yet specialized for complex numbers.
      *
@@ -2116,25 +2366,21 @@ namespace xt
         XTL_REQUIRES(std::negation<is_reducer_options<X>>, xtl::is_integral<D>)>
     inline auto variance(E&& e, X&& axes, const D& ddof, EVS es = EVS())
     {
-        decltype(auto) sc = detail::shared_forward<E>(e);
-        // note: forcing copy of first axes argument -- is there a better solution?
-        auto axes_copy = axes;
-        // always eval to prevent repeated evaluations in the next calls
-        auto inner_mean = eval(mean<T>(sc, std::move(axes_copy), evaluation_strategy::immediate));
-
-        // fake keep_dims = 1
-        // Since the inner_shape might have a reference semantic (e.g. xbuffer_adaptor in bindings)
-        // We need to map it to another type before modifying it.
-        // We pragmatically abuse `get_strides_t`
-        using tmp_shape_t = get_strides_t<typename std::decay_t<E>::shape_type>;
-        tmp_shape_t keep_dim_shape = xtl::forward_sequence<tmp_shape_t, decltype(e.shape())>(e.shape());
-        for (const auto& el : axes)
-        {
-            keep_dim_shape[el] = 1u;
+        using value_type = typename std::decay_t<
+            decltype(detail::two_pass_variance<T>(e, std::forward<X>(axes), ddof, es))>::value_type;
+        if constexpr (std::is_floating_point<value_type>::value)
+        {
+            return detail::welford_variance_reducer<value_type>(
+                ddof,
+                std::forward<E>(e),
+                std::forward<X>(axes),
+                es
+            );
+        }
+        else
+        {
+            return detail::two_pass_variance<T>(std::forward<E>(e), std::forward<X>(axes), ddof, es);
         }
-
-        auto mrv = reshape_view<XTENSOR_DEFAULT_LAYOUT>(std::move(inner_mean), std::move(keep_dim_shape));
-        return detail::mean<T>(square(sc - std::move(mrv)), std::forward<X>(axes), ddof, es);
     }
 
     template <
@@ -2261,6 +2507,269 @@ namespace xt
         );
     }
 
+    /**
+     * @brief Statistics of the elements of an expression, computed by \ref describe.
+     *
+     * The members have the shape of the expression reduced over the described axis.
+     * @tparam V the value type of the expression
+     * @tparam T the floating point type of the sums, means and variances
+     * @tparam I the type of the counts and of the positions
+     */
+    template <class V, class T, class I = std::size_t>
+    struct describe_result
+    {
+        xarray<I> count;
+        xarray<T> sum;
+        xarray<T> mean;
+        xarray<T> variance;
+        xarray<V> min;
+        xarray<V> max;
+        xarray<I> argmin;
+        xarray<I> argmax;
+    };
+
+    namespace detail
+    {
+        /**
+         * State of the reduction computing the statistics of \ref describe. The
+         * positions of the minimum and the maximum are indices in the sequence
+         * of reduced values, hence merging two states requires the values of
+         * the second one to follow the values of the first one.
+         */
+        template <class V, class T>
+        struct describe_state
+        {
+            welford_state<T> moments;
+            T sum;
+            V min;
+            V max;
+            std::size_t argmin;
+            std::size_t argmax;
+        };
+
+        template <class V, class T>
+        struct describe_merge
+        {
+            describe_state<V, T>
+            operator()(const describe_state<V, T>& lhs, const describe_state<V, T>& rhs) const
+            {
+                if (rhs.moments.count == 0)
+                {
+                    return lhs;
+                }
+                if (lhs.moments.count == 0)
+                {
+                    return rhs;
+                }
+                std::size_t offset = lhs.moments.count;
+                describe_state<V, T> res = lhs;
+                res.moments = welford_merge<T>()(lhs.moments, rhs.moments);
+                res.sum += rhs.sum;
+                if (rhs.min < lhs.min)
+                {
+                    res.min = rhs.min;
+                    res.argmin = offset + rhs.argmin;
+                }
+                if (rhs.max > lhs.max)
+                {
+                    res.max = rhs.max;
+                    res.argmax = offset + rhs.argmax;
+                }
+                return res;
+            }
+        };
+
+        template <class V, class T>
+        struct describe_reduce
+        {
+            describe_state<V, T> operator()(describe_state<V, T> s, const V& v) const
+            {
+                if (s.moments.count == 0 || v < s.min)
+                {
+                    s.min = v;
+                    s.argmin = s.moments.count;
+                }
+                if (s.moments.count == 0 || v > s.max)
+                {
+                    s.max = v;
+                    s.argmax = s.moments.count;
+                }
+                s.moments = welford_reduce<T>()(s.moments, v);
+                s.sum += static_cast<T>(v);
+                return s;
+            }
+
+            // Computes the statistics of blocks of consecutive values with branch free
+            // loops over a buffer in cache, and merges their states
+            template <class It>
+            describe_state<V, T> reduce_range(describe_state<V, T> s, It first, It last) const
+            {
+                constexpr std::size_t block_size = 512;
+                std::array<V, block_size> values;
+                std::array<T, block_size> block;
+                while (first != last)
+                {
+                    std::size_t n = 0;
+                    for (; n != block_size && first != last; ++n, ++first)
+                    {
+                        values[n] = *first;
+                        block[n] = static_cast<T>(values[n]);
+                    }
+                    // Like the element-wise reduction, a NaN is only kept if it is the very first
+                    // value; in the other blocks, the extrema are seeded from the first other value
+                    std::size_t seed = 0;
+                    if (s.moments.count != 0)
+                    {
+                        while (seed + 1 < n && !(values[seed] == values[seed]))
+                        {
+                            ++seed;
+                        }
+                    }
+                    V min = values[seed];
+                    V max = values[seed];
+                    std::size_t min_pos = seed;
+                    std::size_t max_pos = seed;
+                    for (std::size_t i = seed + 1; i < n; ++i)
+                    {
+                        const bool lower = values[i] < min;
+                        const bool greater = values[i] > max;
+                        min = lower ? values[i] : min;
+                        min_pos = lower ? i : min_pos;
+                        max = greater ? values[i] : max;
+                        max_pos = greater ? i : max_pos;
+                    }
+                    T sum = unrolled_block_sum(
+                        block,
+                        n,
+                        [](T x)
+                        {
+                            return x;
+                        }
+                    );
+                    describe_state<V, T> bs = {
+                        welford_block_state(block, n, sum),
+                        sum,
+                        min,
+                        max,
+                        min_pos,
+                        max_pos
+                    };
+                    s = describe_merge<V, T>()(s, bs);
+                }
+                return s;
+            }
+        };
+
+        template <class V, class T>
+        inline auto describe_functors()
+        {
+            using state_type = describe_state<V, T>;
+            return make_xreducer_functor(
+                describe_reduce<V, T>(),
+                const_value<state_type>(state_type{{0, T(0), T(0)}, T(0), V(), V(), 0, 0}),
+                describe_merge<V, T>()
+            );
+        }
+
+        template <class T, class V>
+        using describe_value_type_t = std::conditional_t<
+            std::is_void<T>::value,
+            std::conditional_t<std::is_floating_point<V>::value, V, double>,
+            T>;
+
+        // Unpacks an expression of states into the tensors of the statistics
+        template <class V, class T, class S>
+        inline describe_result<V, T> make_describe_result(const S& states)
+        {
+            const xarray<describe_state<V, T>> s = states;
+            describe_result<V, T> res;
+            res.count.resize(s.shape());
+            res.sum.resize(s.shape());
+            res.mean.resize(s.shape());
+            res.variance.resize(s.shape());
+            res.min.resize(s.shape());
+            res.max.resize(s.shape());
+            res.argmin.resize(s.shape());
+            res.argmax.resize(s.shape());
+            for (std::size_t i = 0; i < s.size(); ++i)
+            {
+                const auto& state = s.flat(i);
+                res.count.flat(i) = state.moments.count;
+                res.sum.flat(i) = state.sum;
+                res.mean.flat(i) = state.moments.mean;
+                res.variance.flat(i) = welford_variance<T>{T(0)}(state.moments);
+                res.min.flat(i) = state.min;
+                res.max.flat(i) = state.max;
+                res.argmin.flat(i) = state.argmin;
+                res.argmax.flat(i) = state.argmax;
+            }
+            return res;
+        }
+    }
+
+    /**
+     * @ingroup red_functions
+     * @brief Count, sum, mean, variance, minimum, maximum and positions of the
+     * minimum and of the maximum of the elements of an expression.
+     *
+     * The statistics are computed in a single pass over the elements of the
+     * flattened expression. The positions of the minimum and of the maximum are
+     * the first ones in the flattened array, traversed in row major order, like
+     * \ref argmin and \ref argmax. The variance is the population variance,
+     * computed like \ref variance.
+     *
+     * @param e an \ref xexpression
+     * @param es evaluation strategy and options of the underlying reduction
+     * @tparam T the floating point type of the sums, means and variances. The default is
+     *           the value type of \a e if it is a floating point type, ``double`` otherwise.
+     * @return a \ref describe_result
+     *
+     * @sa minmax, variance
+     */
+    template <class T = void, class E, class EVS = DEFAULT_STRATEGY_REDUCERS, XTL_REQUIRES(is_reducer_options<EVS>)>
+    inline auto describe(E&& e, EVS es = EVS())
+    {
+        using value_type = typename std::decay_t<E>::value_type;
+        using result_type = detail::describe_value_type_t<T, value_type>;
+        std::array<std::size_t, 1> shape = {e.size()};
+        return detail::make_describe_result<value_type, result_type>(xt::reduce(
+            detail::describe_functors<value_type, result_type>(),
+            reshape_view<XTENSOR_DEFAULT_TRAVERSAL>(std::forward<E>(e), shape),
+            es
+        ));
+    }
+
+    /**
+     * @ingroup red_functions
+     * @brief Count, sum, mean, variance, minimum, maximum and positions of the
+     * minimum and of the maximum of the elements of an expression along an axis.
+     *
+     * The statistics are computed in a single pass over the elements, the
+     * positions of the minimum and of the maximum being indices along \a axis.
+     *
+     * @param e an \ref xexpression
+     * @param axis the axis along which the statistics are computed
+     * @param es evaluation strategy and options of the underlying reduction
+     * @tparam T the floating point type of the sums, means and variances. The default is
+     *           the value type of \a e if it is a floating point type, ``double`` otherwise.
+     * @return a \ref describe_result
+     *
+     * @sa minmax, variance
+     */
+    template <class T = void, class E, class EVS = DEFAULT_STRATEGY_REDUCERS, XTL_REQUIRES(is_reducer_options<EVS>)>
+    inline auto describe(E&& e, std::ptrdiff_t axis, EVS es = EVS())
+    {
+        using value_type = typename std::decay_t<E>::value_type;
+        using result_type = detail::describe_value_type_t<T, value_type>;
+        std::array<std::size_t, 1> axes = {normalize_axis(e.dimension(), axis)};
+        return detail::make_describe_result<value_type, result_type>(xt::reduce(
+            detail::describe_functors<value_type, result_type>(),
+            std::forward<E>(e),
+            axes,
+            es
+        ));
+    }
+
     /**
      * @defgroup acc_functions accumulating functions
      */
@@ -2365,6 +2874,53 @@ namespace xt
             }
         };
 
+        /**
+         * Reduces the values [first, last) with the NaN-ignoring functor \c f,
+         * starting from \p init. Contiguous values of the type of the result are
+         * reduced by SIMD batches in several accumulators starting from the
+         * identity of \c f, whose simd_apply masks the NaN values with a
+         * compare-and-blend instead of branching on each of them.
+         */
+        template <class F, class R, class It>
+        inline R nan_reduce_range(const F& f, R init, It first, It last)
+        {
+            if constexpr (std::is_pointer<It>::value
+                          && std::is_same<std::remove_cv_t<std::remove_pointer_t<It>>, R>::value
+                          && has_simd_type<R>::value && !std::is_same<R, bool>::value)
+            {
+                using batch_type = xt_simd::simd_type<R>;
+                constexpr std::size_t simd_size = xt_simd::simd_traits<R>::size;
+                constexpr std::size_t nb_acc = 4;
+                constexpr std::ptrdiff_t step = static_cast<std::ptrdiff_t>(nb_acc * simd_size);
+                if (last - first >= step)
+                {
+                    std::array<batch_type, nb_acc> acc;
+                    acc.fill(xt_simd::broadcast_as<R>(F::template identity<R>()));
+                    for (; last - first >= step; first += step)
+                    {
+                        for (std::size_t k = 0; k < nb_acc; ++k)
+                        {
+                            auto x = xt_simd::load_as<R>(first + k * simd_size, xt_simd::unaligned_mode());
+                            acc[k] = f.simd_apply(acc[k], x);
+                        }
+                    }
+                    batch_type res = f.simd_apply(f.simd_apply(acc[0], acc[1]), f.simd_apply(acc[2], acc[3]));
+
+                    std::array<R, simd_size> lanes;
+                    xt_simd::store_as(lanes.data(), res, xt_simd::unaligned_mode());
+                    for (const auto& v : lanes)
+                    {
+                        init = static_cast<R>(f(init, v));
+                    }
+                }
+            }
+            for (; first != last; ++first)
+            {
+                init = static_cast<R>(f(init, *first));
+            }
+            return init;
+        }
+
         struct nan_min
         {
             template <class T, class U>
@@ -2378,6 +2934,25 @@ namespace xt
                                                    detail::make_xfunction<math::minimum<void>>(lhs, rhs)
                                                ));
             }
+
+            template <class B>
+            B simd_apply(const B& lhs, const B& rhs) const
+            {
+                return xt_simd::select((lhs != lhs) || (rhs < lhs), rhs, lhs);
+            }
+
+            template <class T>
+            static constexpr T identity()
+            {
+                return std::numeric_limits<T>::has_quiet_NaN ? std::numeric_limits<T>::quiet_NaN()
+                                                             : (std::numeric_limits<T>::max)();
+            }
+
+            template <class R, class It>
+            R reduce_range(R init, It first, It last) const
+            {
+                return nan_reduce_range(*this, init, first, last);
+            }
         };
 
         struct nan_max
@@ -2393,6 +2968,25 @@ namespace xt
                                                    detail::make_xfunction<math::maximum<void>>(lhs, rhs)
                                                ));
             }
+
+            template <class B>
+            B simd_apply(const B& lhs, const B& rhs) const
+            {
+                return xt_simd::select((lhs != lhs) || (rhs > lhs), rhs, lhs);
+            }
+
+            template <class T>
+            static constexpr T identity()
+            {
+                return std::numeric_limits<T>::has_quiet_NaN ? std::numeric_limits<T>::quiet_NaN()
+                                                             : std::numeric_limits<T>::lowest();
+            }
+
+            template <class R, class It>
+            R reduce_range(R init, It first, It last) const
+            {
+                return nan_reduce_range(*this, init, first, last);
+            }
         };
 
         struct nan_plus
@@ -2402,6 +2996,25 @@ namespace xt
             {
                 return !math::isnan(rhs) ? lhs + rhs : lhs;
             }
+
+            template <class B>
+            B simd_apply(const B& lhs, const B& rhs) const
+            {
+                using value_type = xt_simd::revert_simd_type<B>;
+                return lhs + xt_simd::select(rhs != rhs, B(value_type(0)), rhs);
+            }
+
+            template <class T>
+            static constexpr T identity()
+            {
+                return T(0);
+            }
+
+            template <class R, class It>
+            R reduce_range(R init, It first, It last) const
+            {
+                return nan_reduce_range(*this, init, first, last);
+            }
         };
 
         struct nan_multiplies
@@ -2411,6 +3024,25 @@ namespace xt
             {
                 return !math::isnan(rhs) ? lhs * rhs : lhs;
             }
+
+            template <class B>
+            B simd_apply(const B& lhs, const B& rhs) const
+            {
+                using value_type = xt_simd::revert_simd_type<B>;
+                return lhs * xt_simd::select(rhs != rhs, B(value_type(1)), rhs);
+            }
+
+            template <class T>
+            static constexpr T identity()
+            {
+                return T(1);
+            }
+
+            template <class R, class It>
+            R reduce_range(R init, It first, It last) const
+            {
+                return nan_reduce_range(*this, init, first, last);
+            }
         };
 
         template <class T, int V>
@@ -2424,6 +3056,124 @@ namespace xt
                 return math::isnan(lhs) ? result_type(V) : lhs;
             }
         };
+
+        /**
+         * Sum and number of the non-NaN values of a set, from which their mean
+         * is computed in a single pass.
+         */
+        template <class T>
+        struct nan_mean_state
+        {
+            T sum;
+            std::size_t count;
+        };
+
+        template <class T>
+        struct nan_mean_merge
+        {
+            nan_mean_state<T> operator()(const nan_mean_state<T>& lhs, const nan_mean_state<T>& rhs) const
+            {
+                return {static_cast<T>(lhs.sum + rhs.sum), lhs.count + rhs.count};
+            }
+        };
+
+        // Adds the non-NaN values to a state
+        template <class T>
+        struct nan_mean_reduce
+        {
+            template <class V>
+            nan_mean_state<T> operator()(nan_mean_state<T> s, const V& v) const
+            {
+                if (!math::isnan(v))
+                {
+                    s.sum = static_cast<T>(s.sum + v);
+                    ++s.count;
+                }
+                return s;
+            }
+
+            // Contiguous floating point values are summed and counted by SIMD batches, the NaN
+            // values being masked out with a compare-and-blend.
+            template <class It>
+            nan_mean_state<T> reduce_range(nan_mean_state<T> s, It first, It last) const
+            {
+                if constexpr (std::is_pointer<It>::value
+                              && std::is_same<std::remove_cv_t<std::remove_pointer_t<It>>, T>::value
+                              && std::is_floating_point<T>::value && has_simd_type<T>::value)
+                {
+                    using batch_type = xt_simd::simd_type<T>;
+                    constexpr std::size_t simd_size = xt_simd::simd_traits<T>::size;
+                    constexpr std::ptrdiff_t step = static_cast<std::ptrdiff_t>(2 * simd_size);
+                    // the lane counts are flushed before they exceed the exactly representable integers
+                    constexpr int count_digits = (std::min)(std::numeric_limits<T>::digits - 1, 30);
+                    constexpr std::size_t flush_period = std::size_t(1) << count_digits;
+                    const batch_type zero(T(0));
+                    const batch_type one(T(1));
+                    while (last - first >= step)
+                    {
+                        std::array<batch_type, 2> sum = {zero, zero};
+                        std::array<batch_type, 2> count = {zero, zero};
+                        for (std::size_t i = 0; i != flush_period && last - first >= step; ++i, first += step)
+                        {
+                            for (std::size_t k = 0; k < 2; ++k)
+                            {
+                                auto x = xt_simd::load_as<T>(
+                                    first + k * simd_size,
+                                    xt_simd::unaligned_mode()
+                                );
+                                auto is_nan = x != x;
+                                sum[k] += xt_simd::select(is_nan, zero, x);
+                                count[k] += xt_simd::select(is_nan, zero, one);
+                            }
+                        }
+                        std::array<T, simd_size> sum_lanes;
+                        std::array<T, simd_size> count_lanes;
+                        xt_simd::store_as(sum_lanes.data(), sum[0] + sum[1], xt_simd::unaligned_mode());
+                        xt_simd::store_as(count_lanes.data(), count[0] + count[1], xt_simd::unaligned_mode());
+                        for (std::size_t k = 0; k < simd_size; ++k)
+                        {
+                            s.sum += sum_lanes[k];
+                            s.count += static_cast<std::size_t>(count_lanes[k]);
+                        }
+                    }
+                }
+                for (; first != last; ++first)
+                {
+                    s = (*this)(s, *first);
+                }
+                return s;
+            }
+        };
+
+        template <class V>
+        struct nan_mean_value
+        {
+            template <class T>
+            auto operator()(const nan_mean_state<T>& s) const
+            {
+                return s.sum / static_cast<V>(s.count);
+            }
+        };
+
+        // Mean of the non-NaN values of e, summed as by nansum<S>, args being the reducer axes and options
+        template <class V, class S, class E, class... A>
+        inline auto nan_mean_reducer(E&& e, A&&... args)
+        {
+            using value_type = typename std::decay_t<E>::value_type;
+            using plus_type = decltype(nan_plus()(std::declval<S>(), std::declval<value_type>()));
+            using sum_type = std::decay_t<plus_type>;
+            using state_type = nan_mean_state<sum_type>;
+            auto reducer = xt::reduce(
+                make_xreducer_functor(
+                    nan_mean_reduce<sum_type>(),
+                    const_value<state_type>(state_type{sum_type(0), 0}),
+                    nan_mean_merge<sum_type>()
+                ),
+                std::forward<E>(e),
+                std::forward<A>(args)...
+            );
+            return make_lambda_xfunction(nan_mean_value<V>(), std::move(reducer));
+        }
     }
 
     /**
@@ -2745,9 +3495,6 @@ namespace xt
         XTL_REQUIRES(std::negation<is_reducer_options<X>>)>
     inline auto nanmean(E&& e, X&& axes, EVS es = EVS())
     {
-        decltype(auto) sc = detail::shared_forward<E>(e);
-        // note: forcing copy of first axes argument -- is there a better solution?
-        auto axes_copy = axes;
         using value_type = typename std::conditional_t<std::is_same<T, void>::value, double, T>;
         using sum_type = typename std::conditional_t<
             std::is_same<T, void>::value,
@@ -2755,20 +3502,18 @@ namespace xt
             T>;
         // sum cannot always be a double. It could be a complex number which cannot operate on
         // std::plus<double>.
-        return nansum<sum_type>(sc, std::forward<X>(axes), es)
-               / xt::cast<value_type>(count_nonnan(sc, std::move(axes_copy), es));
+        return detail::nan_mean_reducer<value_type, sum_type>(std::forward<E>(e), std::forward<X>(axes), es);
     }
 
     template <class T = void, class E, class EVS = DEFAULT_STRATEGY_REDUCERS, XTL_REQUIRES(is_reducer_options<EVS>)>
     inline auto nanmean(E&& e, EVS es = EVS())
     {
-        decltype(auto) sc = detail::shared_forward<E>(e);
         using value_type = typename std::conditional_t<std::is_same<T, void>::value, double, T>;
         using sum_type = typename std::conditional_t<
             std::is_same<T, void>::value,
             typename std::common_type_t<typename std::decay_t<E>::value_type, value_type>,
             T>;
-        return nansum<sum_type>(sc, es) / xt::cast<value_type>(count_nonnan(sc, es));
+        return detail::nan_mean_reducer<value_type, sum_type>(std::forward<E>(e), es);
     }
 
     template <class T = void, class E, class I, std::size_t N, class EVS = DEFAULT_STRATEGY_REDUCERS>
@@ -2784,8 +3529,19 @@ namespace xt
     template <class T = void, class E, class EVS = DEFAULT_STRATEGY_REDUCERS, XTL_REQUIRES(is_reducer_options<EVS>)>
     inline auto nanvar(E&& e, EVS es = EVS())
     {
-        decltype(auto) sc = detail::shared_forward<E>(e);
-        return nanmean<T>(square(sc - nanmean<T>(sc)), es);
+        using result_type = typename std::conditional_t<std::is_same<T, void>::value, double, T>;
+        // Like the two-pass computation, the single pass one computes and returns the
+        // variance in the common type of the result type and of the values
+        using state_type = std::common_type_t<result_type, typename std::decay_t<E>::value_type>;
+        if constexpr (std::is_floating_point<result_type>::value && std::is_floating_point<state_type>::value)
+        {
+            return detail::welford_variance_reducer<state_type, true>(0u, std::forward<E>(e), es);
+        }
+        else
+        {
+            decltype(auto) sc = detail::shared_forward<E>(e);
+            return nanmean<T>(square(sc - nanmean<T>(sc)), es);
+        }
     }
 
     template <class T = void, class E, class EVS = DEFAULT_STRATEGY_REDUCERS, XTL_REQUIRES(is_reducer_options<EVS>)>
@@ -2822,24 +3578,41 @@ namespace xt
         XTL_REQUIRES(std::negation<is_reducer_options<X>>)>
     inline auto nanvar(E&& e, X&& axes, EVS es = EVS())
     {
-        decltype(auto) sc = detail::shared_forward<E>(e);
-        // note: forcing copy of first axes argument -- is there a better solution?
-        auto axes_copy = axes;
         using result_type = typename std::conditional_t<std::is_same<T, void>::value, double, T>;
-        auto inner_mean = nanmean<result_type>(sc, std::move(axes_copy));
-
-        // fake keep_dims = 1
-        // Since the inner_shape might have a reference semantic (e.g. xbuffer_adaptor in bindings)
-        // We need to map it to another type before modifying it.
-        // We pragmatically abuse `get_strides_t`
-        using tmp_shape_t = get_strides_t<typename std::decay_t<E>::shape_type>;
-        tmp_shape_t keep_dim_shape = xtl::forward_sequence<tmp_shape_t, decltype(e.shape())>(e.shape());
-        for (const auto& el : axes)
+        using state_type = std::common_type_t<result_type, typename std::decay_t<E>::value_type>;
+        if constexpr (std::is_floating_point<result_type>::value && std::is_floating_point<state_type>::value)
+        {
+            return detail::welford_variance_reducer<state_type, true>(
+                0u,
+                std::forward<E>(e),
+                std::forward<X>(axes),
+                es
+            );
+        }
+        else
         {
-            keep_dim_shape[el] = 1;
+            decltype(auto) sc = detail::shared_forward<E>(e);
+            // note: forcing copy of first axes argument -- is there a better solution?
+            auto axes_copy = axes;
+            auto inner_mean = nanmean<result_type>(sc, std::move(axes_copy));
+
+            // fake keep_dims = 1
+            // Since the inner_shape might have a reference semantic (e.g. xbuffer_adaptor in bindings)
+            // We need to map it to another type before modifying it.
+            // We pragmatically abuse `get_strides_t`
+            using tmp_shape_t = get_strides_t<typename std::decay_t<E>::shape_type>;
+            tmp_shape_t keep_dim_shape = xtl::forward_sequence<tmp_shape_t, decltype(e.shape())>(e.shape());
+            for (const auto& el : axes)
+            {
+                keep_dim_shape[el] = 1;
+            }
+            auto mrv = reshape_view<XTENSOR_DEFAULT_LAYOUT>(std::move(inner_mean), std::move(keep_dim_shape));
+            return nanmean<result_type>(
+                square(cast<result_type>(sc) - std::move(mrv)),
+                std::forward<X>(axes),
+                es
+            );
         }
-        auto mrv = reshape_view<XTENSOR_DEFAULT_LAYOUT>(std::move(inner_mean), std::move(keep_dim_shape));
-        return nanmean<result_type>(square(cast<result_type>(sc) - std::move(mrv)), std::forward<X>(axes), es);
     }
 
     /**
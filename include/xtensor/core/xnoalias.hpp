@@ -76,6 +76,9 @@ namespace xt
         template <class E>
         A operator^=(const xexpression<E>&);
 
+        template <class E>
+        A assign(const xexpression<E>& e, const execution_policy& policy);
+
     private:
 
         A m_array;
@@ -220,6 +223,21 @@ namespace xt
         return m_array.bit_xor_assign(e);
     }
 
+    /**
+     * Assigns the xexpression \c e without temporary, running the assignment
+     * loop with the execution policy \c policy.
+     *
+     * @code{.cpp}
+     * xt::noalias(a).assign(b + c, xt::par);
+     * @endcode
+     */
+    template <class A>
+    template <class E>
+    inline A noalias_proxy<A>::assign(const xexpression<E>& e, const execution_policy& policy)
+    {
+        return m_array.assign(e, policy);
+    }
+
     template <class A>
     inline noalias_proxy<xtl::closure_type_t<A>> noalias(A&& a) noexcept
     {
@@ -125,6 +125,20 @@ namespace xt
         BINARY_OPERATOR_FUNCTOR(equal_to, ==);
         BINARY_OPERATOR_FUNCTOR(not_equal_to, !=);
 
+    }
+
+    template <>
+    struct functor_cost<detail::divides> : std::integral_constant<std::size_t, 4>
+    {
+    };
+
+    template <>
+    struct functor_cost<detail::modulus> : std::integral_constant<std::size_t, 4>
+    {
+    };
+
+    namespace detail
+    {
         struct conditional_ternary
         {
             template <class B>
@@ -114,6 +114,9 @@ namespace xt
         template <class E>
         derived_type& assign(const xexpression<E>&);
 
+        template <class E>
+        derived_type& assign(const xexpression<E>&, const execution_policy& policy);
+
         template <class E>
         derived_type& plus_assign(const xexpression<E>&);
 
@@ -185,7 +188,10 @@ namespace xt
         derived_type& assign_temporary(temporary_type&&);
 
         template <class E>
-        derived_type& assign_xexpression(const xexpression<E>& e);
+        derived_type& assign_xexpression(
+            const xexpression<E>& e,
+            const execution_policy& policy = execution::default_policy
+        );
 
         template <class E>
         derived_type& computed_assign(const xexpression<E>& e);
@@ -262,7 +268,10 @@ namespace xt
         derived_type& assign_temporary(temporary_type&&);
 
         template <class E>
-        derived_type& assign_xexpression(const xexpression<E>& e);
+        derived_type& assign_xexpression(
+            const xexpression<E>& e,
+            const execution_policy& policy = execution::default_policy
+        );
 
         template <class E>
         derived_type& computed_assign(const xexpression<E>& e);
@@ -513,6 +522,21 @@ namespace xt
         return this->derived_cast().assign_xexpression(e);
     }
 
+    /**
+     * Assigns the xexpression \c e to \c *this with the execution policy
+     * \c policy. Ensures no temporary will be used to perform the assignment.
+     * @param e the xexpression to assign.
+     * @param policy the execution policy, e.g. \c xt::seq or \c xt::par.
+     * @return a reference to \c *this.
+     */
+    template <class D>
+    template <class E>
+    inline auto xsemantic_base<D>::assign(const xexpression<E>& e, const execution_policy& policy)
+        -> derived_type&
+    {
+        return this->derived_cast().assign_xexpression(e, policy);
+    }
+
     /**
      * Adds the xexpression \c e to \c *this. Ensures no temporary
      * will be used to perform the assignment.
@@ -656,9 +680,11 @@ namespace xt
 
     template <class D>
     template <class E>
-    inline auto xcontainer_semantic<D>::assign_xexpression(const xexpression<E>& e) -> derived_type&
+    inline auto
+    xcontainer_semantic<D>::assign_xexpression(const xexpression<E>& e, const execution_policy& policy)
+        -> derived_type&
     {
-        xt::assign_xexpression(*this, e);
+        xt::assign_xexpression(*this, e, policy);
         return this->derived_cast();
     }
 
@@ -723,10 +749,11 @@ namespace xt
 
     template <class D>
     template <class E>
-    inline auto xview_semantic<D>::assign_xexpression(const xexpression<E>& e) -> derived_type&
+    inline auto xview_semantic<D>::assign_xexpression(const xexpression<E>& e, const execution_policy& policy)
+        -> derived_type&
     {
         xt::assert_compatible_shape(*this, e);
-        xt::assign_data(*this, e, detail::get_rhs_triviality(e.derived_cast()));
+        xt::assign_data(*this, e, detail::get_rhs_triviality(e.derived_cast()), policy);
         return this->derived_cast();
     }
 
@@ -110,6 +110,42 @@
 #define XTENSOR_TBB_THRESHOLD 0
 #endif
 
+#ifndef XTENSOR_THREADS_THRESHOLD
+#define XTENSOR_THREADS_THRESHOLD 0
+#endif
+
+#ifndef XTENSOR_PARALLEL_MIN_WORK
+#define XTENSOR_PARALLEL_MIN_WORK 65536
+#endif
+
+#ifndef XTENSOR_PARALLEL_MIN_CHUNK_WORK
+#define XTENSOR_PARALLEL_MIN_CHUNK_WORK 8192
+#endif
+
+#ifndef XTENSOR_STREAMING_STORE_THRESHOLD
+#define XTENSOR_STREAMING_STORE_THRESHOLD 0
+#endif
+
+#ifndef XTENSOR_FIRST_TOUCH_THRESHOLD
+#define XTENSOR_FIRST_TOUCH_THRESHOLD 0
+#endif
+
+#ifndef XTENSOR_PAGE_SIZE
+#define XTENSOR_PAGE_SIZE 4096
+#endif
+
+#ifndef XTENSOR_L1_CACHE_SIZE
+#define XTENSOR_L1_CACHE_SIZE 32768
+#endif
+
+#ifndef XTENSOR_DEFAULT_EXECUTION
+#if defined(XTENSOR_USE_TBB) || defined(XTENSOR_USE_OPENMP) || defined(XTENSOR_USE_THREADS)
+#define XTENSOR_DEFAULT_EXECUTION ::xt::execution_backend::parallel
+#else
+#define XTENSOR_DEFAULT_EXECUTION ::xt::execution_backend::sequential
+#endif
+#endif
+
 #ifndef XTENSOR_SELECT_ALIGN
 #define XTENSOR_SELECT_ALIGN(T) (XTENSOR_DEFAULT_ALIGNMENT != 0 ? XTENSOR_DEFAULT_ALIGNMENT : alignof(T))
 #endif
@@ -2,10 +2,12 @@
 #include <oneapi/tbb.h>
 #endif
 #include <stdexcept>
+#include <vector>
 
 #include <xtl/xcomplex.hpp>
 
 #include "../containers/xarray.hpp"
+#include "../core/xexecution.hpp"
 #include "../core/xmath.hpp"
 #include "../core/xnoalias.hpp"
 #include "../generators/xbuilder.hpp"
@@ -122,10 +124,12 @@ namespace xt
          * @brief 1D FFT of an Nd array along a specified axis
          * @param e an Nd expression to be transformed to the fourier domain
          * @param axis the axis along which to perform the 1D FFT
+         * @param policy the execution policy used to transform the 1D slices
          * @return a transformed xarray of the specified precision
          */
         template <class E>
-        inline auto fft(E&& e, std::ptrdiff_t axis = -1)
+        inline auto
+        fft(E&& e, std::ptrdiff_t axis = -1, const execution_policy& policy = execution::default_policy)
         {
             using value_type = typename std::decay<E>::type::value_type;
             if constexpr (xtl::is_complex<typename std::decay<E>::type::value_type>::value)
@@ -135,29 +139,62 @@ namespace xt
                 const size_t N = e.shape(saxis);
                 const bool powerOfTwo = !(N == 0) && !(N & (N - 1));
                 xt::xarray<std::complex<precision>> out = xt::eval(e);
-                auto begin = xt::axis_slice_begin(out, saxis);
+                // The slices are independent, gather them so that they can be
+                // transformed concurrently.
+                using slice_iterator = decltype(xt::axis_slice_begin(out, saxis));
+                std::vector<slice_iterator> slices;
                 auto end = xt::axis_slice_end(out, saxis);
-                for (auto iter = begin; iter != end; iter++)
+                for (auto iter = xt::axis_slice_begin(out, saxis); iter != end; iter++)
                 {
-                    if (powerOfTwo)
-                    {
-                        xt::noalias(*iter) = detail::radix2(*iter);
-                    }
-                    else
+                    slices.push_back(iter);
+                }
+                auto transform_slices = [&slices, powerOfTwo](std::size_t first, std::size_t last)
+                {
+                    for (std::size_t i = first; i < last; ++i)
                     {
-                        xt::noalias(*iter) = detail::transform_bluestein(*iter);
+                        if (powerOfTwo)
+                        {
+                            xt::noalias(*slices[i]) = detail::radix2(*slices[i]);
+                        }
+                        else
+                        {
+                            xt::noalias(*slices[i]) = detail::transform_bluestein(*slices[i]);
+                        }
                     }
+                };
+                // A radix-2 transform costs about log2(N) butterflies per element, the
+                // Bluestein algorithm runs three of them on twice as many elements.
+                std::size_t log2_n = 1;
+                while ((std::size_t(1) << log2_n) < N)
+                {
+                    ++log2_n;
+                }
+                std::size_t cost = (powerOfTwo ? 8 : 48) * log2_n;
+                if (policy.use_parallel(slices.size() * N, cost))
+                {
+                    xt::detail::parallel_for(
+                        policy,
+                        std::size_t(0),
+                        slices.size(),
+                        transform_slices,
+                        policy.grain_size(cost * N)
+                    );
+                }
+                else
+                {
+                    transform_slices(std::size_t(0), slices.size());
                 }
                 return out;
             }
             else
             {
-                return fft(xt::cast<std::complex<value_type>>(e), axis);
+                return fft(xt::cast<std::complex<value_type>>(e), axis, policy);
             }
         }
 
         template <class E>
-        inline auto ifft(E&& e, std::ptrdiff_t axis = -1)
+        inline auto
+        ifft(E&& e, std::ptrdiff_t axis = -1, const execution_policy& policy = execution::default_policy)
         {
             if constexpr (xtl::is_complex<typename std::decay<E>::type::value_type>::value)
             {
@@ -168,14 +205,14 @@ namespace xt
                     XTENSOR_THROW(std::runtime_error, "Cannot take the iFFT along an empty dimention");
                 }
                 auto complex_args = xt::conj(e);
-                auto fft_res = xt::fft::fft(complex_args, axis);
+                auto fft_res = xt::fft::fft(complex_args, axis, policy);
                 fft_res = xt::conj(fft_res);
                 return fft_res;
             }
             else
             {
                 using value_type = typename std::decay<E>::type::value_type;
-                return ifft(xt::cast<std::complex<value_type>>(e), axis);
+                return ifft(xt::cast<std::complex<value_type>>(e), axis, policy);
             }
         }
 
@@ -185,9 +222,15 @@ namespace xt
          * @param xvec first array of the convolution
          * @param yvec second array of the convolution
          * @param axis axis along which to perform the convolution
+         * @param policy the execution policy used by the transforms
          */
         template <typename E1, typename E2>
-        auto convolve(E1&& xvec, E2&& yvec, std::ptrdiff_t axis = -1)
+        auto convolve(
+            E1&& xvec,
+            E2&& yvec,
+            std::ptrdiff_t axis = -1,
+            const execution_policy& policy = execution::default_policy
+        )
         {
             // we could broadcast but that could get complicated???
             if (xvec.dimension() != yvec.dimension())
@@ -203,8 +246,8 @@ namespace xt
 
             const std::size_t n = xvec.shape(saxis);
 
-            auto xv = fft(xvec, axis);
-            auto yv = fft(yvec, axis);
+            auto xv = fft(xvec, axis, policy);
+            auto yv = fft(yvec, axis, policy);
 
             auto begin_x = xt::axis_slice_begin(xv, saxis);
             auto end_x = xt::axis_slice_end(xv, saxis);
@@ -215,7 +258,7 @@ namespace xt
                 (*iter) = (*iter_y++) * (*iter);
             }
 
-            auto outvec = ifft(xv, axis);
+            auto outvec = ifft(xv, axis, policy);
 
             // Scaling (because this FFT implementation omits it)
             outvec = outvec / n;
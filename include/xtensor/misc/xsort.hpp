@@ -11,22 +11,30 @@
 #define XTENSOR_SORT_HPP
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <iterator>
+#include <limits>
 #include <utility>
+#include <vector>
 
 #include <xtl/xcompare.hpp>
 
 #include "../containers/xadapt.hpp"
 #include "../containers/xarray.hpp"
+#include "../containers/xstorage.hpp"
 #include "../containers/xtensor.hpp"
 #include "../core/xeval.hpp"
+#include "../core/xexecution.hpp"
 #include "../core/xmath.hpp"
 #include "../core/xtensor_config.hpp"
 #include "../core/xtensor_forward.hpp"
 #include "../misc/xmanipulation.hpp"
 #include "../views/xindex_view.hpp"
 #include "../views/xslice.hpp"  // for xnone
+#include "../utils/xtensor_simd.hpp"
 #include "../views/xview.hpp"
 
 namespace xt
@@ -38,6 +46,32 @@ namespace xt
      * input and may allocate temporaries.
      */
 
+    /**
+     * Sorting method.
+     * Predefined methods for performing direct and indirect sorting.
+     * @see sort(const xexpression<E>&, std::ptrdiff_t, sorting_method, const execution_policy&)
+     * @see argsort(const xexpression<E>&, std::ptrdiff_t, sorting_method, const execution_policy&)
+     */
+    enum class sorting_method
+    {
+        /**
+         *  Faster method but with no guarantee on preservation of order of equal elements
+         *  https://en.cppreference.com/w/cpp/algorithm/sort.
+         */
+        quick,
+        /**
+         *  Slower method but with guarantee on preservation of order of equal elements
+         *  https://en.cppreference.com/w/cpp/algorithm/stable_sort.
+         */
+        stable,
+        /**
+         *  Stable LSD radix sort, one byte per pass, for integral types and 32 or 64 bit
+         *  IEEE floating point types; other types are sorted as with \c stable.
+         *  Negative zeros are sorted before positive zeros.
+         */
+        radix,
+    };
+
     namespace detail
     {
         template <class T>
@@ -72,8 +106,57 @@ namespace xt
             return std::accumulate(ev.shape().begin() + 1, ev.shape().end(), std::size_t(1), std::multiplies<>());
         }
 
+        // Estimated number of comparisons per element for sorting n elements
+        inline std::size_t sort_cost(std::size_t n)
+        {
+            std::size_t cost = 1;
+            for (; n > 1; n >>= 1)
+            {
+                ++cost;
+            }
+            return cost;
+        }
+
+        /**
+         * Calls f(i, lane_policy) for the n_lanes lanes of lane_size elements to sort.
+         * The lanes are split between the threads of the policy when there are at least
+         * as many lanes as threads, lane_policy being then sequential; otherwise the lanes
+         * are processed one after the other, each with the policy.
+         */
+        template <class F>
+        inline void
+        for_each_lane(const execution_policy& policy, std::size_t n_lanes, std::size_t lane_size, F&& f)
+        {
+            const std::size_t cost = sort_cost(lane_size);
+            const bool split_lanes = n_lanes >= 2 && n_lanes >= policy.concurrency();
+            if (split_lanes && policy.use_parallel(n_lanes * lane_size, cost))
+            {
+                const std::size_t grain = policy.grain_size(cost) / std::max(lane_size, std::size_t(1));
+                parallel_for(
+                    policy,
+                    std::size_t(0),
+                    n_lanes,
+                    [&f](std::size_t first, std::size_t last)
+                    {
+                        for (std::size_t i = first; i < last; ++i)
+                        {
+                            f(i, execution::seq);
+                        }
+                    },
+                    grain
+                );
+            }
+            else
+            {
+                for (std::size_t i = 0; i < n_lanes; ++i)
+                {
+                    f(i, policy);
+                }
+            }
+        }
+
         template <class E, class F>
-        inline void call_over_leading_axis(E& ev, F&& fct)
+        inline void call_over_leading_axis(const execution_policy& policy, E& ev, F&& fct)
         {
             XTENSOR_ASSERT(ev.dimension() >= 2);
 
@@ -81,15 +164,33 @@ namespace xt
             const std::ptrdiff_t secondary_stride = get_secondary_stride(ev);
 
             const auto begin = ev.data();
-            const auto end = begin + n_iters * secondary_stride;
-            for (auto iter = begin; iter != end; iter += secondary_stride)
-            {
-                fct(iter, iter + secondary_stride);
-            }
+            for_each_lane(
+                policy,
+                n_iters,
+                static_cast<std::size_t>(secondary_stride),
+                [&](std::size_t i, const execution_policy& lane_policy)
+                {
+                    const auto iter = begin + static_cast<std::ptrdiff_t>(i) * secondary_stride;
+                    fct(iter, iter + secondary_stride, lane_policy);
+                }
+            );
+        }
+
+        template <class E, class F>
+        inline void call_over_leading_axis(E& ev, F&& fct)
+        {
+            call_over_leading_axis(
+                execution::seq,
+                ev,
+                [&fct](auto first, auto last, const execution_policy&)
+                {
+                    fct(first, last);
+                }
+            );
         }
 
         template <class E1, class E2, class F>
-        inline void call_over_leading_axis(E1& e1, E2& e2, F&& fct)
+        inline void call_over_leading_axis(const execution_policy& policy, E1& e1, E2& e2, F&& fct)
         {
             XTENSOR_ASSERT(e1.dimension() >= 2);
             XTENSOR_ASSERT(e1.dimension() == e2.dimension());
@@ -100,15 +201,32 @@ namespace xt
             XTENSOR_ASSERT(secondary_stride1 == secondary_stride2);
 
             const auto begin1 = e1.data();
-            const auto end1 = begin1 + n_iters * secondary_stride1;
             const auto begin2 = e2.data();
-            const auto end2 = begin2 + n_iters * secondary_stride2;
-            auto iter1 = begin1;
-            auto iter2 = begin2;
-            for (; (iter1 != end1) && (iter2 != end2); iter1 += secondary_stride1, iter2 += secondary_stride2)
-            {
-                fct(iter1, iter1 + secondary_stride1, iter2, iter2 + secondary_stride2);
-            }
+            for_each_lane(
+                policy,
+                n_iters,
+                static_cast<std::size_t>(secondary_stride1),
+                [&](std::size_t i, const execution_policy& lane_policy)
+                {
+                    const auto iter1 = begin1 + static_cast<std::ptrdiff_t>(i) * secondary_stride1;
+                    const auto iter2 = begin2 + static_cast<std::ptrdiff_t>(i) * secondary_stride2;
+                    fct(iter1, iter1 + secondary_stride1, iter2, iter2 + secondary_stride2, lane_policy);
+                }
+            );
+        }
+
+        template <class E1, class E2, class F>
+        inline void call_over_leading_axis(E1& e1, E2& e2, F&& fct)
+        {
+            call_over_leading_axis(
+                execution::seq,
+                e1,
+                e2,
+                [&fct](auto first1, auto last1, auto first2, auto last2, const execution_policy&)
+                {
+                    fct(first1, last1, first2, last2);
+                }
+            );
         }
 
         template <class E>
@@ -122,61 +240,1016 @@ namespace xt
             {
                 return 0;
             }
-            XTENSOR_THROW(std::runtime_error, "Layout not supported.");
-        }
+            XTENSOR_THROW(std::runtime_error, "Layout not supported.");
+        }
+
+        /**
+         * Scratch buffer of at least n elements for sorts. Buffers of small sorts,
+         * such as the sorts of the lanes of an axis, are kept by each thread for its
+         * next sorts; larger ones are allocated in \p owned for a single sort.
+         *
+         * A thread waiting for a parallel region may run tasks of other sorts, which
+         * would reuse its kept buffer: \p keep must be false if the buffer is still in
+         * use while a parallel region runs.
+         */
+        template <int Tag, class T>
+        inline T* sort_scratch(std::vector<T>& owned, std::size_t n, bool keep = true)
+        {
+            constexpr std::size_t max_kept_size = (std::size_t(1) << 20) / sizeof(T);
+            thread_local std::vector<T> kept;
+            std::vector<T>& scratch = keep && n <= max_kept_size ? kept : owned;
+            if (scratch.size() < n)
+            {
+                scratch.resize(n);
+            }
+            return scratch.data();
+        }
+
+        /**
+         * Lanes along an axis of a dense tensor which is not its leading axis: the
+         * lane (o, i) holds the n elements o * n * inner + i + k * inner.
+         */
+        struct strided_lanes
+        {
+            std::size_t outer;
+            std::size_t n;
+            std::size_t inner;
+        };
+
+        template <class E>
+        inline strided_lanes get_strided_lanes(const E& e, std::size_t ax)
+        {
+            const auto& shape = e.shape();
+            const auto axis_it = shape.begin() + static_cast<std::ptrdiff_t>(ax);
+            const std::size_t before = std::accumulate(
+                shape.begin(),
+                axis_it,
+                std::size_t(1),
+                std::multiplies<>()
+            );
+            const std::size_t after = std::accumulate(
+                axis_it + 1,
+                shape.end(),
+                std::size_t(1),
+                std::multiplies<>()
+            );
+            if (e.layout() == layout_type::row_major)
+            {
+                return {before, shape[ax], after};
+            }
+            return {after, shape[ax], before};
+        }
+
+        /**
+         * Number of lanes of n elements, out of n_lanes, to process at once so that a
+         * block fits in the L1 cache while each of its rows spans at least a cache line.
+         */
+        inline std::size_t lane_block_width(std::size_t n, std::size_t n_lanes, std::size_t elem_size)
+        {
+            return std::min(
+                n_lanes,
+                std::max(std::size_t(64) / elem_size, std::size_t(XTENSOR_L1_CACHE_SIZE) / (n * elem_size))
+            );
+        }
+
+        /**
+         * Calls f(offset, width, block_policy) on blocks of width strided lanes adjacent
+         * in memory, the first one starting at offset, as wide as lane_block_width allows.
+         * Blocks are split between the threads of the policy as the lanes are by
+         * for_each_lane.
+         */
+        template <class F>
+        inline void for_each_lane_block(
+            const execution_policy& policy,
+            const strided_lanes& lanes,
+            std::size_t elem_size,
+            F&& f
+        )
+        {
+            const std::size_t n = lanes.n;
+            const std::size_t n_lanes = lanes.outer * lanes.inner;
+            if (n == 0 || n_lanes == 0)
+            {
+                return;
+            }
+            const std::size_t max_width = lane_block_width(n, lanes.inner, elem_size);
+            const std::size_t blocks_per_outer = (lanes.inner + max_width - 1) / max_width;
+            const auto run = [&](std::size_t first, std::size_t last, const execution_policy& block_policy)
+            {
+                for (std::size_t b = first; b < last; ++b)
+                {
+                    const std::size_t o = b / blocks_per_outer;
+                    const std::size_t i = (b % blocks_per_outer) * max_width;
+                    f(o * n * lanes.inner + i, std::min(max_width, lanes.inner - i), block_policy);
+                }
+            };
+
+            const std::size_t nb_blocks = lanes.outer * blocks_per_outer;
+            const std::size_t cost = sort_cost(n);
+            const bool split_lanes = n_lanes >= 2 && n_lanes >= policy.concurrency();
+            if (split_lanes && policy.use_parallel(n_lanes * n, cost))
+            {
+                parallel_for(
+                    policy,
+                    std::size_t(0),
+                    nb_blocks,
+                    [&run](std::size_t first, std::size_t last)
+                    {
+                        run(first, last, execution::seq);
+                    },
+                    policy.grain_size(cost) / (max_width * n)
+                );
+            }
+            else
+            {
+                run(0, nb_blocks, policy);
+            }
+        }
+
+        // Copies the width strided lanes of n elements starting at src to contiguous lanes in dst
+        template <class T, class U>
+        inline void
+        gather_lanes(const T* src, U* dst, std::size_t n, std::size_t stride, std::size_t width)
+        {
+            for (std::size_t k = 0; k < n; ++k, src += stride)
+            {
+                for (std::size_t j = 0; j < width; ++j)
+                {
+                    dst[j * n + k] = src[j];
+                }
+            }
+        }
+
+        // Copies width contiguous lanes of n elements from src to the strided lanes starting at dst
+        template <class T, class U>
+        inline void
+        scatter_lanes(const T* src, U* dst, std::size_t n, std::size_t stride, std::size_t width)
+        {
+            for (std::size_t k = 0; k < n; ++k, dst += stride)
+            {
+                for (std::size_t j = 0; j < width; ++j)
+                {
+                    dst[j] = src[j * n + k];
+                }
+            }
+        }
+
+        /**
+         * Calls fct(first, last, lane_policy) on the lanes along the axis ax of the dense
+         * tensor e, which is not its leading axis, without transposing e: blocks of lanes
+         * adjacent in memory are gathered into a contiguous scratch buffer, processed and
+         * scattered back.
+         */
+        template <class E, class F>
+        inline void call_over_strided_axis(const execution_policy& policy, E& e, std::size_t ax, F&& fct)
+        {
+            using value_type = typename E::value_type;
+            const strided_lanes lanes = get_strided_lanes(e, ax);
+            const std::size_t n = lanes.n;
+            value_type* data = e.data();
+            for_each_lane_block(
+                policy,
+                lanes,
+                sizeof(value_type),
+                [&](std::size_t offset, std::size_t width, const execution_policy& lane_policy)
+                {
+                    // A lane may be sorted in parallel when there are fewer lanes than threads
+                    const bool keep = !lane_policy.is_parallel();
+                    std::vector<value_type> owned;
+                    value_type* buffer = sort_scratch<2>(owned, width * n, keep);
+                    gather_lanes(data + offset, buffer, n, lanes.inner, width);
+                    for (std::size_t j = 0; j < width; ++j)
+                    {
+                        fct(buffer + j * n, buffer + (j + 1) * n, lane_policy);
+                    }
+                    scatter_lanes(buffer, data + offset, n, lanes.inner, width);
+                }
+            );
+        }
+
+        /**
+         * Same as above for fct(first1, last1, first2, last2, lane_policy) called on the
+         * lanes of e1 and e2, of the same shape and layout; the lanes of e2 are only read
+         * and those of e1 are only written.
+         */
+        template <class E1, class E2, class F>
+        inline void
+        call_over_strided_axis(const execution_policy& policy, E1& e1, const E2& e2, std::size_t ax, F&& fct)
+        {
+            using value_type1 = typename E1::value_type;
+            using value_type2 = typename E2::value_type;
+            XTENSOR_ASSERT(e1.layout() == e2.layout());
+            XTENSOR_ASSERT(std::equal(e1.shape().cbegin(), e1.shape().cend(), e2.shape().cbegin()));
+            const strided_lanes lanes = get_strided_lanes(e2, ax);
+            const std::size_t n = lanes.n;
+            value_type1* data1 = e1.data();
+            const value_type2* data2 = e2.data();
+            for_each_lane_block(
+                policy,
+                lanes,
+                std::max(sizeof(value_type1), sizeof(value_type2)),
+                [&](std::size_t offset, std::size_t width, const execution_policy& lane_policy)
+                {
+                    const bool keep = !lane_policy.is_parallel();
+                    std::vector<value_type1> owned1;
+                    std::vector<value_type2> owned2;
+                    value_type1* buffer1 = sort_scratch<2>(owned1, width * n, keep);
+                    value_type2* buffer2 = sort_scratch<3>(owned2, width * n, keep);
+                    gather_lanes(data2 + offset, buffer2, n, lanes.inner, width);
+                    for (std::size_t j = 0; j < width; ++j)
+                    {
+                        const std::size_t first = j * n;
+                        const std::size_t last = first + n;
+                        fct(buffer1 + first, buffer1 + last, buffer2 + first, buffer2 + last, lane_policy);
+                    }
+                    scatter_lanes(buffer1, data1 + offset, n, lanes.inner, width);
+                }
+            );
+        }
+
+        // Calls fct(first, last, lane_policy) on the lanes along the axis ax of the dense tensor e
+        template <class E, class F>
+        inline void call_over_axis(const execution_policy& policy, E& e, std::size_t ax, F&& fct)
+        {
+            if (ax == leading_axis(e))
+            {
+                call_over_leading_axis(policy, e, std::forward<F>(fct));
+            }
+            else
+            {
+                call_over_strided_axis(policy, e, ax, std::forward<F>(fct));
+            }
+        }
+
+        /**
+         * Sorting networks: many short lanes are sorted at once by applying each
+         * comparator of a network to the rows of a block of lanes, the k-th row
+         * holding the k-th element of every lane of the block. The compare-exchange
+         * of two rows is then a few SIMD operations for as many lanes as the batches
+         * hold, without any branch.
+         */
+
+        // Largest lane size sorted with a sorting network
+        constexpr std::size_t max_network_size = 64;
+        // Fewest lanes for a sorting network to be worth it
+        constexpr std::size_t min_network_lanes = 16;
+
+        using sorting_network = std::vector<std::pair<std::uint8_t, std::uint8_t>>;
+
+        /**
+         * Comparators of Batcher's odd-even merge sort of n elements, in the order
+         * they are applied; the comparator (i, j), with i < j, puts the lesser
+         * element at i.
+         */
+        inline sorting_network make_sorting_network(std::size_t n)
+        {
+            sorting_network network;
+            for (std::size_t p = 1; p < n; p <<= 1)
+            {
+                for (std::size_t k = p; k >= 1; k >>= 1)
+                {
+                    for (std::size_t j = k % p; j + k < n; j += 2 * k)
+                    {
+                        for (std::size_t i = 0; i < std::min(k, n - j - k); ++i)
+                        {
+                            if ((i + j) / (2 * p) == (i + j + k) / (2 * p))
+                            {
+                                network.emplace_back(
+                                    static_cast<std::uint8_t>(i + j),
+                                    static_cast<std::uint8_t>(i + j + k)
+                                );
+                            }
+                        }
+                    }
+                }
+            }
+            return network;
+        }
+
+        inline const sorting_network& get_sorting_network(std::size_t n)
+        {
+            XTENSOR_ASSERT(n <= max_network_size);
+            static const std::array<sorting_network, max_network_size + 1> networks = []()
+            {
+                std::array<sorting_network, max_network_size + 1> res;
+                for (std::size_t i = 0; i < res.size(); ++i)
+                {
+                    res[i] = make_sorting_network(i);
+                }
+                return res;
+            }();
+            return networks[n];
+        }
+
+        /**
+         * Whether the lanes of n elements of a tensor of the given size are sorted with
+         * a sorting network. Networks do not keep the order of equivalent elements, which
+         * only matters for the values when they can be told apart, such as -0. and 0.
+         * Positions are sorted along with the keys in their own type, which represents
+         * them exactly, and break the ties so that argsort is stable.
+         */
+        template <class T>
+        inline bool
+        use_sorting_network(sorting_method method, std::size_t n, std::size_t size, bool with_positions)
+        {
+            constexpr bool is_sortable = std::is_arithmetic<T>::value && !std::is_same<T, bool>::value;
+            const bool same_result = method == sorting_method::quick || std::is_integral<T>::value
+                                     || (with_positions && method == sorting_method::stable);
+            return is_sortable && same_result && n >= 2 && n <= max_network_size
+                   && size / n >= min_network_lanes;
+        }
+
+        /**
+         * Compare-exchanges the elements of the rows a and b of width elements: a[j]
+         * gets the lesser of a[j] and b[j] and b[j] the other one. The elements are
+         * exchanged rather than replaced by their minimum and maximum so that the
+         * lanes remain permutations when they hold NaN values.
+         */
+        template <class T>
+        inline void compare_exchange_rows(T* a, T* b, std::size_t width)
+        {
+            std::size_t j = 0;
+            if constexpr (has_simd_type<T>::value)
+            {
+                using batch_type = xt_simd::simd_type<T>;
+                constexpr std::size_t simd_size = xt_simd::simd_traits<T>::size;
+                for (; j + simd_size <= width; j += simd_size)
+                {
+                    const batch_type x = xt_simd::load_as<T>(a + j, xt_simd::unaligned_mode());
+                    const batch_type y = xt_simd::load_as<T>(b + j, xt_simd::unaligned_mode());
+                    const auto swap = y < x;
+                    xt_simd::store_as(a + j, xt_simd::select(swap, y, x), xt_simd::unaligned_mode());
+                    xt_simd::store_as(b + j, xt_simd::select(swap, x, y), xt_simd::unaligned_mode());
+                }
+            }
+            for (; j < width; ++j)
+            {
+                const T x = a[j];
+                const T y = b[j];
+                const bool swap = y < x;
+                a[j] = swap ? y : x;
+                b[j] = swap ? x : y;
+            }
+        }
+
+        // Same as above for the keys a and b, ordered with their positions pa and pb
+        template <class T>
+        inline void compare_exchange_rows(T* a, T* b, T* pa, T* pb, std::size_t width)
+        {
+            std::size_t j = 0;
+            if constexpr (has_simd_type<T>::value)
+            {
+                using batch_type = xt_simd::simd_type<T>;
+                constexpr std::size_t simd_size = xt_simd::simd_traits<T>::size;
+                for (; j + simd_size <= width; j += simd_size)
+                {
+                    const batch_type x = xt_simd::load_as<T>(a + j, xt_simd::unaligned_mode());
+                    const batch_type y = xt_simd::load_as<T>(b + j, xt_simd::unaligned_mode());
+                    const batch_type px = xt_simd::load_as<T>(pa + j, xt_simd::unaligned_mode());
+                    const batch_type py = xt_simd::load_as<T>(pb + j, xt_simd::unaligned_mode());
+                    const auto swap = (y < x) || ((y == x) && (py < px));
+                    xt_simd::store_as(a + j, xt_simd::select(swap, y, x), xt_simd::unaligned_mode());
+                    xt_simd::store_as(b + j, xt_simd::select(swap, x, y), xt_simd::unaligned_mode());
+                    xt_simd::store_as(pa + j, xt_simd::select(swap, py, px), xt_simd::unaligned_mode());
+                    xt_simd::store_as(pb + j, xt_simd::select(swap, px, py), xt_simd::unaligned_mode());
+                }
+            }
+            for (; j < width; ++j)
+            {
+                const T x = a[j];
+                const T y = b[j];
+                const T px = pa[j];
+                const T py = pb[j];
+                const bool swap = (y < x) || ((y == x) && (py < px));
+                a[j] = swap ? y : x;
+                b[j] = swap ? x : y;
+                pa[j] = swap ? py : px;
+                pb[j] = swap ? px : py;
+            }
+        }
+
+        /**
+         * Copies the width lanes of n elements whose k-th element of the j-th lane is at
+         * src[k * src_row_stride + j * src_lane_stride] to dst, with the strides of dst.
+         */
+        template <class T, class U>
+        inline void copy_lanes(
+            const T* src,
+            std::size_t src_row_stride,
+            std::size_t src_lane_stride,
+            U* dst,
+            std::size_t dst_row_stride,
+            std::size_t dst_lane_stride,
+            std::size_t n,
+            std::size_t width
+        )
+        {
+            for (std::size_t k = 0; k < n; ++k)
+            {
+                for (std::size_t j = 0; j < width; ++j)
+                {
+                    dst[k * dst_row_stride + j * dst_lane_stride] = static_cast<U>(
+                        src[k * src_row_stride + j * src_lane_stride]
+                    );
+                }
+            }
+        }
+
+        /**
+         * Calls f(offset, row_stride, lane_stride, width) on blocks of width lanes along
+         * the axis ax of the dense tensor e; the k-th element of the j-th lane of a block
+         * is at offset + k * row_stride + j * lane_stride. Blocks are sized and split
+         * between the threads of the policy as by for_each_lane_block.
+         */
+        template <class E, class F>
+        inline void for_each_network_block(
+            const execution_policy& policy,
+            const E& e,
+            std::size_t ax,
+            std::size_t elem_size,
+            F&& f
+        )
+        {
+            const std::size_t n = e.shape()[ax];
+            if (ax != leading_axis(e))
+            {
+                const strided_lanes lanes = get_strided_lanes(e, ax);
+                for_each_lane_block(
+                    policy,
+                    lanes,
+                    elem_size,
+                    [&](std::size_t offset, std::size_t width, const execution_policy&)
+                    {
+                        f(offset, lanes.inner, std::size_t(1), width);
+                    }
+                );
+            }
+            else
+            {
+                const std::size_t n_lanes = e.size() / n;
+                const std::size_t width = lane_block_width(n, n_lanes, elem_size);
+                for_each_lane(
+                    policy,
+                    (n_lanes + width - 1) / width,
+                    width * n,
+                    [&](std::size_t b, const execution_policy&)
+                    {
+                        f(b * width * n, std::size_t(1), n, std::min(width, n_lanes - b * width));
+                    }
+                );
+            }
+        }
+
+        /**
+         * Sorts the lanes along the axis ax of the dense tensor e with a sorting network.
+         * Lanes along another axis than the leading one are sorted in place; those along
+         * the leading axis are first transposed by blocks into a scratch buffer.
+         */
+        template <class E>
+        inline void network_sort_axis(const execution_policy& policy, E& e, std::size_t ax)
+        {
+            using value_type = typename E::value_type;
+            const std::size_t n = e.shape()[ax];
+            const sorting_network& network = get_sorting_network(n);
+            value_type* data = e.data();
+            for_each_network_block(
+                policy,
+                e,
+                ax,
+                sizeof(value_type),
+                [&](std::size_t offset, std::size_t row_stride, std::size_t lane_stride, std::size_t width)
+                {
+                    value_type* first = data + offset;
+                    if (lane_stride == 1)
+                    {
+                        for (const auto& c : network)
+                        {
+                            value_type* a = first + c.first * row_stride;
+                            compare_exchange_rows(a, first + c.second * row_stride, width);
+                        }
+                        return;
+                    }
+                    std::vector<value_type> owned;
+                    value_type* rows = sort_scratch<2>(owned, width * n);
+                    copy_lanes(first, row_stride, lane_stride, rows, width, std::size_t(1), n, width);
+                    for (const auto& c : network)
+                    {
+                        compare_exchange_rows(rows + c.first * width, rows + c.second * width, width);
+                    }
+                    copy_lanes(rows, width, std::size_t(1), first, row_stride, lane_stride, n, width);
+                }
+            );
+        }
+
+        /**
+         * Stores in res the indices sorting the lanes along the axis ax of the dense
+         * tensor ev, of the same shape and layout, with a sorting network applied to
+         * copies of the lanes and to their positions.
+         */
+        template <class R, class E>
+        inline void network_argsort_axis(const execution_policy& policy, R& res, const E& ev, std::size_t ax)
+        {
+            using value_type = typename E::value_type;
+            using index_type = typename R::value_type;
+            const std::size_t n = ev.shape()[ax];
+            const sorting_network& network = get_sorting_network(n);
+            const value_type* data = ev.data();
+            index_type* indices = res.data();
+            for_each_network_block(
+                policy,
+                ev,
+                ax,
+                2 * sizeof(value_type),
+                [&](std::size_t offset, std::size_t row_stride, std::size_t lane_stride, std::size_t width)
+                {
+                    std::vector<value_type> owned_keys;
+                    std::vector<value_type> owned_positions;
+                    value_type* keys = sort_scratch<2>(owned_keys, width * n);
+                    value_type* positions = sort_scratch<3>(owned_positions, width * n);
+                    copy_lanes(data + offset, row_stride, lane_stride, keys, width, std::size_t(1), n, width);
+                    for (std::size_t k = 0; k < n; ++k)
+                    {
+                        std::fill_n(positions + k * width, width, static_cast<value_type>(k));
+                    }
+                    for (const auto& c : network)
+                    {
+                        const std::size_t a = c.first * width;
+                        const std::size_t b = c.second * width;
+                        compare_exchange_rows(keys + a, keys + b, positions + a, positions + b, width);
+                    }
+                    index_type* first = indices + offset;
+                    copy_lanes(positions, width, std::size_t(1), first, row_stride, lane_stride, n, width);
+                }
+            );
+        }
+
+        // get permutations to transpose and reverse-transpose array
+        inline std::pair<dynamic_shape<std::size_t>, dynamic_shape<std::size_t>>
+        get_permutations(std::size_t dim, std::size_t ax, layout_type layout)
+        {
+            dynamic_shape<std::size_t> permutation(dim);
+            std::iota(permutation.begin(), permutation.end(), std::size_t(0));
+            permutation.erase(permutation.begin() + std::ptrdiff_t(ax));
+
+            if (layout == layout_type::row_major)
+            {
+                permutation.push_back(ax);
+            }
+            else
+            {
+                permutation.insert(permutation.begin(), ax);
+            }
+
+            // TODO find a more clever way to get reverse permutation?
+            dynamic_shape<std::size_t> reverse_permutation;
+            for (std::size_t i = 0; i < dim; ++i)
+            {
+                auto it = std::find(permutation.begin(), permutation.end(), i);
+                reverse_permutation.push_back(std::size_t(std::distance(permutation.begin(), it)));
+            }
+
+            return std::make_pair(std::move(permutation), std::move(reverse_permutation));
+        }
+
+        // Calls lambda(first, last, lane_policy) on the lanes of a copy of e along axis
+        template <class R, class E, class F>
+        inline R map_axis(const E& e, std::ptrdiff_t axis, const execution_policy& policy, F&& lambda)
+        {
+            if (e.dimension() == 1)
+            {
+                R res = e;
+                lambda(res.begin(), res.end(), policy);
+                return res;
+            }
+
+            R res = e;
+            call_over_axis(policy, res, normalize_axis(e.dimension(), axis), std::forward<F>(lambda));
+            return res;
+        }
+
+        template <class R, class E, class F>
+        inline R map_axis(const E& e, std::ptrdiff_t axis, F&& lambda)
+        {
+            return map_axis<R>(
+                e,
+                axis,
+                execution::seq,
+                [&lambda](auto first, auto last, const execution_policy&)
+                {
+                    lambda(first, last);
+                }
+            );
+        }
+
+        /**
+         * Returns the number of elements taken from the first range among the k first
+         * elements of the stable merge of [first1, first1 + n1) and [first2, first2 + n2).
+         */
+        template <class It1, class It2, class Compare>
+        inline std::size_t
+        merge_path_split(It1 first1, std::size_t n1, It2 first2, std::size_t n2, std::size_t k, Compare& comp)
+        {
+            std::size_t lo = k > n2 ? k - n2 : 0;
+            std::size_t hi = std::min(k, n1);
+            while (lo < hi)
+            {
+                const std::size_t i = lo + (hi - lo) / 2;
+                const std::size_t j = k - i;
+                // Equivalent elements of the first range come first
+                if (!comp(first2[static_cast<std::ptrdiff_t>(j - 1)], first1[static_cast<std::ptrdiff_t>(i)]))
+                {
+                    lo = i + 1;
+                }
+                else
+                {
+                    hi = i;
+                }
+            }
+            return lo;
+        }
+
+        /**
+         * Merges the sorted ranges [first1, first1 + n1) and [first2, first2 + n2) into
+         * out, the output being split in contiguous parts merged by different threads.
+         */
+        template <class It, class Out, class Compare>
+        inline void parallel_merge(
+            const execution_policy& policy,
+            It first1,
+            std::size_t n1,
+            It first2,
+            std::size_t n2,
+            Out out,
+            Compare& comp
+        )
+        {
+            const std::size_t n = n1 + n2;
+            const std::size_t nb_parts = std::max(
+                std::min(policy.concurrency(), n / policy.grain_size(2)),
+                std::size_t(1)
+            );
+            auto at = [](auto it, std::size_t i)
+            {
+                return it + static_cast<std::ptrdiff_t>(i);
+            };
+            parallel_for(
+                policy,
+                std::size_t(0),
+                nb_parts,
+                [&](std::size_t part_first, std::size_t part_last)
+                {
+                    for (std::size_t p = part_first; p < part_last; ++p)
+                    {
+                        const std::size_t k0 = n * p / nb_parts;
+                        const std::size_t k1 = n * (p + 1) / nb_parts;
+                        const std::size_t i0 = merge_path_split(first1, n1, first2, n2, k0, comp);
+                        const std::size_t i1 = merge_path_split(first1, n1, first2, n2, k1, comp);
+                        std::merge(
+                            at(first1, i0),
+                            at(first1, i1),
+                            at(first2, k0 - i0),
+                            at(first2, k1 - i1),
+                            at(out, k0),
+                            comp
+                        );
+                    }
+                },
+                1
+            );
+        }
+
+        /**
+         * Sorts [first, last) with the policy: chunks of the range are sorted by
+         * different threads with sort_range(chunk_first, chunk_last), which must order
+         * them as \p comp does, and then merged pairwise, each merge being split
+         * between the threads as well. The merges keep equivalent elements in order.
+         */
+        template <class It, class Compare, class F>
+        inline void
+        parallel_merge_sort(const execution_policy& policy, It first, It last, Compare comp, F&& sort_range)
+        {
+            const std::size_t n = static_cast<std::size_t>(std::distance(first, last));
+            const std::size_t cost = sort_cost(n);
+            const std::size_t nb_chunks = policy.use_parallel(n, cost)
+                                              ? std::min(policy.concurrency(), n / policy.grain_size(cost))
+                                              : std::size_t(1);
+            if (nb_chunks < 2)
+            {
+                sort_range(first, last);
+                return;
+            }
+
+            auto bound = [n, nb_chunks](std::size_t chunk)
+            {
+                return n * std::min(chunk, nb_chunks) / nb_chunks;
+            };
+            parallel_for(
+                policy,
+                std::size_t(0),
+                nb_chunks,
+                [&](std::size_t chunk_first, std::size_t chunk_last)
+                {
+                    for (std::size_t c = chunk_first; c < chunk_last; ++c)
+                    {
+                        sort_range(
+                            first + static_cast<std::ptrdiff_t>(bound(c)),
+                            first + static_cast<std::ptrdiff_t>(bound(c + 1))
+                        );
+                    }
+                },
+                1
+            );
+
+            // Sorted runs of width chunks are merged back and forth between the range and a buffer.
+            // The first round writes the whole buffer, which is therefore left uninitialized.
+            uvector<typename std::iterator_traits<It>::value_type> buffer(n);
+            auto merge_runs = [&](auto src, auto dst, std::size_t width)
+            {
+                for (std::size_t c = 0; c < nb_chunks; c += 2 * width)
+                {
+                    const std::size_t lo = bound(c);
+                    const std::size_t mid = bound(c + width);
+                    const std::size_t hi = bound(c + 2 * width);
+                    const auto src_lo = src + static_cast<std::ptrdiff_t>(lo);
+                    const auto src_mid = src + static_cast<std::ptrdiff_t>(mid);
+                    const auto dst_lo = dst + static_cast<std::ptrdiff_t>(lo);
+                    parallel_merge(policy, src_lo, mid - lo, src_mid, hi - mid, dst_lo, comp);
+                }
+            };
+            bool in_buffer = false;
+            for (std::size_t width = 1; width < nb_chunks; width *= 2)
+            {
+                if (in_buffer)
+                {
+                    merge_runs(buffer.begin(), first, width);
+                }
+                else
+                {
+                    merge_runs(first, buffer.begin(), width);
+                }
+                in_buffer = !in_buffer;
+            }
+            if (in_buffer)
+            {
+                parallel_for(
+                    policy,
+                    std::size_t(0),
+                    n,
+                    [&](std::size_t copy_first, std::size_t copy_last)
+                    {
+                        std::copy(
+                            buffer.begin() + static_cast<std::ptrdiff_t>(copy_first),
+                            buffer.begin() + static_cast<std::ptrdiff_t>(copy_last),
+                            first + static_cast<std::ptrdiff_t>(copy_first)
+                        );
+                    },
+                    policy.grain_size(1)
+                );
+            }
+        }
+
+        // Comparison sort of [first, last) with the policy, stable if stable is true
+        template <class It, class Compare>
+        inline void
+        parallel_sort(const execution_policy& policy, It first, It last, Compare comp, bool stable)
+        {
+            parallel_merge_sort(
+                policy,
+                first,
+                last,
+                comp,
+                [&comp, stable](It range_first, It range_last)
+                {
+                    if (stable)
+                    {
+                        std::stable_sort(range_first, range_last, comp);
+                    }
+                    else
+                    {
+                        std::sort(range_first, range_last, comp);
+                    }
+                }
+            );
+        }
+
+        template <std::size_t N>
+        struct radix_unsigned;
+
+        template <>
+        struct radix_unsigned<1>
+        {
+            using type = std::uint8_t;
+        };
+
+        template <>
+        struct radix_unsigned<2>
+        {
+            using type = std::uint16_t;
+        };
+
+        template <>
+        struct radix_unsigned<4>
+        {
+            using type = std::uint32_t;
+        };
+
+        template <>
+        struct radix_unsigned<8>
+        {
+            using type = std::uint64_t;
+        };
+
+        /**
+         * Unsigned keys whose order is the order of values of type T, defined for
+         * integral types and IEEE floating point types of 32 or 64 bits. Keys of
+         * floating point values have their sign bit flipped if the value is positive
+         * and all their bits flipped if it is negative, so that -0.0 comes before 0.0
+         * and NaN values come after +inf (or before -inf if their sign bit is set).
+         */
+        template <class T, class = void>
+        struct radix_key
+        {
+            static constexpr bool value = false;
+        };
+
+        template <class T>
+        struct radix_key<
+            T,
+            std::enable_if_t<
+                (std::is_integral<T>::value && !std::is_same<T, bool>::value)
+                || (std::is_floating_point<T>::value && std::numeric_limits<T>::is_iec559
+                    && (sizeof(T) == 4 || sizeof(T) == 8))>>
+        {
+            static constexpr bool value = true;
+            using type = typename radix_unsigned<sizeof(T)>::type;
+            static constexpr type sign_bit = static_cast<type>(type(1) << (8 * sizeof(T) - 1));
+
+            static type encode(const T& v) noexcept
+            {
+                if constexpr (std::is_floating_point<T>::value)
+                {
+                    type bits;
+                    std::memcpy(&bits, &v, sizeof(T));
+                    return (bits & sign_bit) ? static_cast<type>(~bits) : static_cast<type>(bits | sign_bit);
+                }
+                else if constexpr (std::is_signed<T>::value)
+                {
+                    return static_cast<type>(static_cast<type>(v) ^ sign_bit);
+                }
+                else
+                {
+                    return static_cast<type>(v);
+                }
+            }
+
+            static T decode(type key) noexcept
+            {
+                if constexpr (std::is_floating_point<T>::value)
+                {
+                    const type bits = (key & sign_bit) ? static_cast<type>(key ^ sign_bit)
+                                                       : static_cast<type>(~key);
+                    T v;
+                    std::memcpy(&v, &bits, sizeof(T));
+                    return v;
+                }
+                else
+                {
+                    return static_cast<T>(key ^ (std::is_signed<T>::value ? sign_bit : type(0)));
+                }
+            }
+        };
 
-        // get permutations to transpose and reverse-transpose array
-        inline std::pair<dynamic_shape<std::size_t>, dynamic_shape<std::size_t>>
-        get_permutations(std::size_t dim, std::size_t ax, layout_type layout)
+        /**
+         * Stable LSD radix sort of the n keys and of their payload (if P is not void),
+         * one byte per pass, using buffers of n elements after them as scratch. Passes
+         * whose byte is the same for all keys are skipped. Returns true if the sorted
+         * keys and payload end up in the scratch buffers.
+         */
+        template <class K, class P>
+        inline bool radix_sort_keys(K* keys, P* payload, std::size_t n)
         {
-            dynamic_shape<std::size_t> permutation(dim);
-            std::iota(permutation.begin(), permutation.end(), std::size_t(0));
-            permutation.erase(permutation.begin() + std::ptrdiff_t(ax));
+            constexpr std::size_t nb_passes = sizeof(K);
+            constexpr std::size_t nb_buckets = 256;
+            std::array<std::array<std::size_t, nb_buckets>, nb_passes> counts = {};
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                for (std::size_t pass = 0; pass < nb_passes; ++pass)
+                {
+                    ++counts[pass][static_cast<std::size_t>(keys[i] >> (8 * pass)) & 0xff];
+                }
+            }
 
-            if (layout == layout_type::row_major)
+            K* src_keys = keys;
+            K* dst_keys = keys + n;
+            P* src_payload = payload;
+            P* dst_payload = payload;
+            if constexpr (!std::is_void<P>::value)
             {
-                permutation.push_back(ax);
+                dst_payload = payload + n;
             }
-            else
+            bool in_scratch = false;
+            for (std::size_t pass = 0; pass < nb_passes; ++pass)
             {
-                permutation.insert(permutation.begin(), ax);
+                auto& offsets = counts[pass];
+                const std::size_t shift = 8 * pass;
+                if (offsets[static_cast<std::size_t>(keys[0] >> shift) & 0xff] == n)
+                {
+                    continue;
+                }
+                std::size_t offset = 0;
+                for (auto& c : offsets)
+                {
+                    std::size_t count = c;
+                    c = offset;
+                    offset += count;
+                }
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    const std::size_t dst = offsets[static_cast<std::size_t>(src_keys[i] >> shift) & 0xff]++;
+                    dst_keys[dst] = src_keys[i];
+                    if constexpr (!std::is_void<P>::value)
+                    {
+                        dst_payload[dst] = src_payload[i];
+                    }
+                }
+                std::swap(src_keys, dst_keys);
+                std::swap(src_payload, dst_payload);
+                in_scratch = !in_scratch;
             }
+            return in_scratch;
+        }
 
-            // TODO find a more clever way to get reverse permutation?
-            dynamic_shape<std::size_t> reverse_permutation;
-            for (std::size_t i = 0; i < dim; ++i)
+        // Radix sort of the values [first, last), whose type has a radix_key
+        template <class It>
+        inline void radix_sort(It first, It last)
+        {
+            using key_traits = radix_key<typename std::iterator_traits<It>::value_type>;
+            using key_type = typename key_traits::type;
+            const std::size_t n = static_cast<std::size_t>(std::distance(first, last));
+            if (n < 2)
             {
-                auto it = std::find(permutation.begin(), permutation.end(), i);
-                reverse_permutation.push_back(std::size_t(std::distance(permutation.begin(), it)));
+                return;
             }
 
-            return std::make_pair(std::move(permutation), std::move(reverse_permutation));
+            std::vector<key_type> owned_keys;
+            key_type* keys = sort_scratch<0>(owned_keys, 2 * n);
+            std::transform(first, last, keys, &key_traits::encode);
+            const key_type* sorted = radix_sort_keys<key_type, void>(keys, nullptr, n) ? keys + n : keys;
+            std::transform(sorted, sorted + n, first, &key_traits::decode);
         }
 
-        template <class R, class E, class F>
-        inline R map_axis(const E& e, std::ptrdiff_t axis, F&& lambda)
+        // Radix sort of the indices [idx_first, idx_last) of the values starting at data_begin
+        template <class ConstRandomIt, class RandomIt>
+        inline void radix_argsort(ConstRandomIt data_begin, RandomIt idx_first, RandomIt idx_last)
         {
-            if (e.dimension() == 1)
+            using key_traits = radix_key<typename std::iterator_traits<ConstRandomIt>::value_type>;
+            using key_type = typename key_traits::type;
+            using index_type = typename std::iterator_traits<RandomIt>::value_type;
+            const std::size_t n = static_cast<std::size_t>(std::distance(idx_first, idx_last));
+            if (n < 2)
             {
-                R res = e;
-                lambda(res.begin(), res.end());
-                return res;
+                return;
             }
 
-            const std::size_t ax = normalize_axis(e.dimension(), axis);
-            if (ax == detail::leading_axis(e))
+            std::vector<key_type> owned_keys;
+            std::vector<index_type> owned_indices;
+            key_type* keys = sort_scratch<0>(owned_keys, 2 * n);
+            index_type* indices = sort_scratch<1>(owned_indices, 2 * n);
+            std::copy(idx_first, idx_last, indices);
+            for (std::size_t i = 0; i < n; ++i)
             {
-                R res = e;
-                detail::call_over_leading_axis(res, std::forward<F>(lambda));
-                return res;
+                keys[i] = key_traits::encode(*(data_begin + static_cast<std::ptrdiff_t>(indices[i])));
             }
+            const index_type* sorted = radix_sort_keys(keys, indices, n) ? indices + n : indices;
+            std::copy(sorted, sorted + n, idx_first);
+        }
 
-            dynamic_shape<std::size_t> permutation, reverse_permutation;
-            std::tie(permutation, reverse_permutation) = get_permutations(e.dimension(), ax, e.layout());
-            R res = transpose(e, permutation);
-            detail::call_over_leading_axis(res, std::forward<F>(lambda));
-            res = transpose(res, reverse_permutation);
-            return res;
+        // Sorts [first, last) with the method and the policy
+        template <class It>
+        inline void sort_range(const execution_policy& policy, It first, It last, sorting_method method)
+        {
+            using value_type = typename std::iterator_traits<It>::value_type;
+            if constexpr (radix_key<value_type>::value)
+            {
+                if (method == sorting_method::radix)
+                {
+                    parallel_merge_sort(
+                        policy,
+                        first,
+                        last,
+                        [](const value_type& lhs, const value_type& rhs)
+                        {
+                            return radix_key<value_type>::encode(lhs) < radix_key<value_type>::encode(rhs);
+                        },
+                        [](It range_first, It range_last)
+                        {
+                            radix_sort(range_first, range_last);
+                        }
+                    );
+                    return;
+                }
+            }
+            parallel_sort(policy, first, last, std::less<>(), method != sorting_method::quick);
         }
 
         template <class VT>
@@ -206,23 +1279,39 @@ namespace xt
         using flatten_sort_result_type_t = typename flatten_sort_result_type<VT>::type;
 
         template <class E, class R = flatten_sort_result_type_t<E>>
-        inline auto flat_sort_impl(const xexpression<E>& e)
+        inline auto
+        flat_sort_impl(const xexpression<E>& e, sorting_method method, const execution_policy& policy)
         {
             const auto& de = e.derived_cast();
             R ev;
             ev.resize({static_cast<typename R::shape_type::value_type>(de.size())});
 
             std::copy(de.cbegin(), de.cend(), ev.begin());
-            std::sort(ev.begin(), ev.end());
+            sort_range(policy, ev.begin(), ev.end(), method);
 
             return ev;
         }
     }
 
     template <class E>
-    inline auto sort(const xexpression<E>& e, placeholders::xtuph /*t*/)
+    inline auto sort(
+        const xexpression<E>& e,
+        placeholders::xtuph /*t*/,
+        sorting_method method,
+        const execution_policy& policy = execution::default_policy
+    )
+    {
+        return detail::flat_sort_impl(e, method, policy);
+    }
+
+    template <class E>
+    inline auto sort(
+        const xexpression<E>& e,
+        placeholders::xtuph t,
+        const execution_policy& policy = execution::default_policy
+    )
     {
-        return detail::flat_sort_impl(e);
+        return sort(e, t, sorting_method::quick, policy);
     }
 
     namespace detail
@@ -238,57 +1327,85 @@ namespace xt
         {
             using type = xtensor<T, sizeof...(I), L>;
         };
+
+        // The expression itself when it is already of the evaluated type R, a copy otherwise
+        template <class E, class R>
+        using sort_operand_t = std::conditional_t<std::is_same<std::decay_t<E>, R>::value, const R&, R>;
     }
 
     /**
      * Sort xexpression (optionally along axis)
-     * The sort is performed using the ``std::sort`` functions.
+     * The sort is performed using the ``std::sort`` functions, or the algorithm
+     * selected by \p method.
      * A copy of the xexpression is created and returned.
      *
+     * With a parallel policy, the lanes along the axis are sorted by different
+     * threads, or each lane is sorted with a parallel merge sort when there are
+     * fewer lanes than threads. The flattened sort ``sort(e, xt::xnone())``
+     * uses the parallel merge sort as well.
+     *
+     * Many lanes of at most 64 arithmetic values are sorted together with a
+     * sorting network, whose comparators are applied to SIMD batches holding
+     * elements of different lanes.
+     *
      * @ingroup xt_xsort
      * @param e xexpression to sort
      * @param axis axis along which sort is performed
+     * @param method sorting algorithm to use
+     * @param policy execution policy deciding whether the sort runs in parallel
      *
      * @return sorted array (copy)
+     *
+     * @see xt::sorting_method
      */
     template <class E>
-    inline auto sort(const xexpression<E>& e, std::ptrdiff_t axis = -1)
+    inline auto sort(
+        const xexpression<E>& e,
+        std::ptrdiff_t axis,
+        sorting_method method,
+        const execution_policy& policy = execution::default_policy
+    )
     {
         using eval_type = typename detail::sort_eval_type<E>::type;
+        using value_type = typename eval_type::value_type;
+
+        const auto& de = e.derived_cast();
+        if (de.dimension() >= 2)
+        {
+            const std::size_t ax = normalize_axis(de.dimension(), axis);
+            if (detail::use_sorting_network<value_type>(method, de.shape()[ax], de.size(), false))
+            {
+                eval_type res = de;
+                detail::network_sort_axis(policy, res, ax);
+                return res;
+            }
+        }
 
         return detail::map_axis<eval_type>(
-            e.derived_cast(),
+            de,
             axis,
-            [](auto begin, auto end)
+            policy,
+            [method](auto begin, auto end, const execution_policy& lane_policy)
             {
-                std::sort(begin, end);
+                detail::sort_range(lane_policy, begin, end, method);
             }
         );
     }
 
+    template <class E>
+    inline auto sort(
+        const xexpression<E>& e,
+        std::ptrdiff_t axis = -1,
+        const execution_policy& policy = execution::default_policy
+    )
+    {
+        return sort(e, axis, sorting_method::quick, policy);
+    }
+
     /*****************************
      * Implementation of argsort *
      *****************************/
 
-    /**
-     * Sorting method.
-     * Predefined methods for performing indirect sorting.
-     * @see argsort(const xexpression<E>&, std::ptrdiff_t, sorting_method)
-     */
-    enum class sorting_method
-    {
-        /**
-         *  Faster method but with no guarantee on preservation of order of equal elements
-         *  https://en.cppreference.com/w/cpp/algorithm/sort.
-         */
-        quick,
-        /**
-         *  Slower method but with guarantee on preservation of order of equal elements
-         *  https://en.cppreference.com/w/cpp/algorithm/stable_sort.
-         */
-        stable,
-    };
-
     namespace detail
     {
         template <class ConstRandomIt, class RandomIt, class Compare, class Method>
@@ -298,7 +1415,8 @@ namespace xt
             RandomIt idx_begin,
             RandomIt idx_end,
             Compare comp,
-            Method method
+            Method method,
+            const execution_policy& policy = execution::seq
         )
         {
             XTENSOR_ASSERT(std::distance(data_begin, data_end) >= 0);
@@ -306,36 +1424,62 @@ namespace xt
             (void) idx_end;  // TODO(C++17) [[maybe_unused]] only used in assertion.
 
             std::iota(idx_begin, idx_end, 0);
+            auto idx_comp = [&](const auto i, const auto j)
+            {
+                return comp(*(data_begin + i), *(data_begin + j));
+            };
             switch (method)
             {
                 case (sorting_method::quick):
                 {
-                    std::sort(
-                        idx_begin,
-                        idx_end,
-                        [&](const auto i, const auto j)
-                        {
-                            return comp(*(data_begin + i), *(data_begin + j));
-                        }
-                    );
+                    parallel_sort(policy, idx_begin, idx_end, idx_comp, false);
+                    break;
                 }
                 case (sorting_method::stable):
                 {
-                    std::stable_sort(
-                        idx_begin,
-                        idx_end,
-                        [&](const auto i, const auto j)
-                        {
-                            return comp(*(data_begin + i), *(data_begin + j));
-                        }
-                    );
+                    parallel_sort(policy, idx_begin, idx_end, idx_comp, true);
+                    break;
+                }
+                case (sorting_method::radix):
+                {
+                    // The indices are ordered by the radix keys of the values, comp is not used
+                    using value_type = typename std::iterator_traits<ConstRandomIt>::value_type;
+                    if constexpr (radix_key<value_type>::value)
+                    {
+                        using key_traits = radix_key<value_type>;
+                        parallel_merge_sort(
+                            policy,
+                            idx_begin,
+                            idx_end,
+                            [&data_begin](const auto i, const auto j)
+                            {
+                                const auto lhs = key_traits::encode(*(data_begin + i));
+                                return lhs < key_traits::encode(*(data_begin + j));
+                            },
+                            [&data_begin](RandomIt range_first, RandomIt range_last)
+                            {
+                                radix_argsort(data_begin, range_first, range_last);
+                            }
+                        );
+                    }
+                    else
+                    {
+                        parallel_sort(policy, idx_begin, idx_end, idx_comp, true);
+                    }
+                    break;
                 }
             }
         }
 
         template <class ConstRandomIt, class RandomIt, class Method>
-        inline void
-        argsort_iter(ConstRandomIt data_begin, ConstRandomIt data_end, RandomIt idx_begin, RandomIt idx_end, Method method)
+        inline void argsort_iter(
+            ConstRandomIt data_begin,
+            ConstRandomIt data_end,
+            RandomIt idx_begin,
+            RandomIt idx_end,
+            Method method,
+            const execution_policy& policy = execution::seq
+        )
         {
             return argsort_iter(
                 std::move(data_begin),
@@ -346,7 +1490,8 @@ namespace xt
                 {
                     return x < y;
                 },
-                method
+                method,
+                policy
             );
         }
 
@@ -392,6 +1537,18 @@ namespace xt
             using type = xtensor_fixed<VT, xshape<fixed_compute_size<S>::value>, L>;
         };
 
+        template <class VT, class T>
+        struct reduce_rebind_value_type
+        {
+            using type = typename rebind_value_type<VT, T>::type;
+        };
+
+        template <class VT, class EC, std::size_t N, layout_type L>
+        struct reduce_rebind_value_type<VT, xtensor<EC, N, L>>
+        {
+            using type = xtensor<VT, N - 1, L>;
+        };
+
         template <class T>
         struct argsort_result_type
         {
@@ -407,7 +1564,8 @@ namespace xt
         };
 
         template <class E, class R = typename detail::linear_argsort_result_type<E>::type, class Method>
-        inline auto flatten_argsort_impl(const xexpression<E>& e, Method method)
+        inline auto
+        flatten_argsort_impl(const xexpression<E>& e, Method method, const execution_policy& policy)
         {
             const auto& de = e.derived_cast();
 
@@ -419,17 +1577,21 @@ namespace xt
             result_type result;
             result.resize({de.size()});
 
-            detail::argsort_iter(de.cbegin(), de.cend(), result.begin(), result.end(), method);
+            detail::argsort_iter(de.cbegin(), de.cend(), result.begin(), result.end(), method, policy);
 
             return result;
         }
     }
 
     template <class E>
-    inline auto
-    argsort(const xexpression<E>& e, placeholders::xtuph /*t*/, sorting_method method = sorting_method::quick)
+    inline auto argsort(
+        const xexpression<E>& e,
+        placeholders::xtuph /*t*/,
+        sorting_method method = sorting_method::quick,
+        const execution_policy& policy = execution::default_policy
+    )
     {
-        return detail::flatten_argsort_impl(e, method);
+        return detail::flatten_argsort_impl(e, method, policy);
     }
 
     /**
@@ -438,18 +1600,27 @@ namespace xt
      * of indices of the same shape as e that index data along the given axis in
      * sorted order.
      *
+     * Short lanes are sorted with a sorting network as by sort; equivalent
+     * elements then keep their order, whatever the method.
+     *
      * @ingroup xt_xsort
      * @param e xexpression to argsort
      * @param axis axis along which argsort is performed
      * @param method sorting algorithm to use
+     * @param policy execution policy deciding whether the sort runs in parallel,
+     *        as for sort(const xexpression<E>&, std::ptrdiff_t, const execution_policy&)
      *
      * @return argsorted index array
      *
      * @see xt::sorting_method
      */
     template <class E>
-    inline auto
-    argsort(const xexpression<E>& e, std::ptrdiff_t axis = -1, sorting_method method = sorting_method::quick)
+    inline auto argsort(
+        const xexpression<E>& e,
+        std::ptrdiff_t axis = -1,
+        sorting_method method = sorting_method::quick,
+        const execution_policy& policy = execution::default_policy
+    )
     {
         using eval_type = typename detail::sort_eval_type<E>::type;
         using result_type = typename detail::argsort_result_type<eval_type>::type;
@@ -460,27 +1631,38 @@ namespace xt
 
         if (de.dimension() == 1)
         {
-            return detail::flatten_argsort_impl<E, result_type>(e, method);
+            return detail::flatten_argsort_impl<E, result_type>(e, method, policy);
         }
 
-        const auto argsort = [&method](auto res_begin, auto res_end, auto ev_begin, auto ev_end)
+        const auto argsort = [&method](
+                                 auto res_begin,
+                                 auto res_end,
+                                 auto ev_begin,
+                                 auto ev_end,
+                                 const execution_policy& lane_policy
+                             )
         {
-            detail::argsort_iter(ev_begin, ev_end, res_begin, res_end, method);
+            detail::argsort_iter(ev_begin, ev_end, res_begin, res_end, method, lane_policy);
         };
 
+        result_type res = result_type::from_shape(de.shape());
+        using value_type = typename eval_type::value_type;
+        if (detail::use_sorting_network<value_type>(method, de.shape()[ax], de.size(), true))
+        {
+            detail::sort_operand_t<E, eval_type> ev = de;
+            detail::network_argsort_axis(policy, res, ev, ax);
+            return res;
+        }
+
         if (ax == detail::leading_axis(de))
         {
-            result_type res = result_type::from_shape(de.shape());
-            detail::call_over_leading_axis(res, de, argsort);
+            detail::call_over_leading_axis(policy, res, de, argsort);
             return res;
         }
 
-        dynamic_shape<std::size_t> permutation, reverse_permutation;
-        std::tie(permutation, reverse_permutation) = detail::get_permutations(de.dimension(), ax, de.layout());
-        eval_type ev = transpose(de, permutation);
-        result_type res = result_type::from_shape(ev.shape());
-        detail::call_over_leading_axis(res, ev, argsort);
-        res = transpose(res, reverse_permutation);
+        // Lanes along the other axes are gathered from memory, which requires an evaluated expression
+        detail::sort_operand_t<E, eval_type> ev = de;
+        detail::call_over_strided_axis(policy, res, ev, ax, argsort);
         return res;
     }
 
@@ -713,8 +1895,13 @@ namespace xt
         }
 
         std::sort(kth_container.begin(), kth_container.end());
-        const auto argpartition_w_kth =
-            [&kth_container](auto res_begin, auto res_end, auto ev_begin, auto /*ev_end*/)
+        const auto argpartition_w_kth = [&kth_container](
+                                            auto res_begin,
+                                            auto res_end,
+                                            auto ev_begin,
+                                            auto /*ev_end*/,
+                                            const execution_policy&
+                                        )
         {
             std::iota(res_begin, res_end, 0);
             detail::partition_iter(
@@ -730,19 +1917,15 @@ namespace xt
         };
 
         const std::size_t ax = normalize_axis(de.dimension(), axis);
+        result_type res = result_type::from_shape(de.shape());
         if (ax == detail::leading_axis(de))
         {
-            result_type res = result_type::from_shape(de.shape());
-            detail::call_over_leading_axis(res, de, argpartition_w_kth);
+            detail::call_over_leading_axis(execution::seq, res, de, argpartition_w_kth);
             return res;
         }
 
-        dynamic_shape<std::size_t> permutation, reverse_permutation;
-        std::tie(permutation, reverse_permutation) = detail::get_permutations(de.dimension(), ax, de.layout());
-        eval_type ev = transpose(de, permutation);
-        result_type res = result_type::from_shape(ev.shape());
-        detail::call_over_leading_axis(res, ev, argpartition_w_kth);
-        res = transpose(res, reverse_permutation);
+        detail::sort_operand_t<E, eval_type> ev = de;
+        detail::call_over_strided_axis(execution::seq, res, ev, ax, argpartition_w_kth);
         return res;
     }
 
@@ -768,76 +1951,79 @@ namespace xt
 
     namespace detail
     {
-        template <class S, class I, class K, class O>
-        inline void select_indices_impl(
-            const S& shape,
-            const I& indices,
-            std::size_t axis,
-            std::size_t current_dim,
-            const K& current_index,
-            O& out
-        )
+        /**
+         * Places at each of the positions [kth_first, kth_last), sorted and unique, of
+         * data[first:last] the element which would be there if it was sorted, the elements
+         * between two positions being between their elements. The middle position is
+         * selected first, then the positions on each side of it among the elements on
+         * that side only.
+         */
+        template <class T, class Iter>
+        inline void nested_select(T* data, std::size_t first, std::size_t last, Iter kth_first, Iter kth_last)
         {
-            using id_t = typename K::value_type;
-            if ((current_dim < shape.size() - 1) && (current_dim == axis))
-            {
-                for (auto i : indices)
-                {
-                    auto idx = current_index;
-                    idx[current_dim] = i;
-                    select_indices_impl(shape, indices, axis, current_dim + 1, idx, out);
-                }
-            }
-            else if ((current_dim < shape.size() - 1) && (current_dim != axis))
-            {
-                for (id_t i = 0; xtl::cmp_less(i, shape[current_dim]); ++i)
-                {
-                    auto idx = current_index;
-                    idx[current_dim] = i;
-                    select_indices_impl(shape, indices, axis, current_dim + 1, idx, out);
-                }
-            }
-            else if ((current_dim == shape.size() - 1) && (current_dim == axis))
-            {
-                for (auto i : indices)
-                {
-                    auto idx = current_index;
-                    idx[current_dim] = i;
-                    out.push_back(std::move(idx));
-                }
-            }
-            else if ((current_dim == shape.size() - 1) && (current_dim != axis))
+            while (kth_first != kth_last)
             {
-                for (id_t i = 0; xtl::cmp_less(i, shape[current_dim]); ++i)
-                {
-                    auto idx = current_index;
-                    idx[current_dim] = i;
-                    out.push_back(std::move(idx));
-                }
+                const Iter mid = kth_first + (kth_last - kth_first) / 2;
+                std::nth_element(data + first, data + *mid, data + last);
+                nested_select(data, first, *mid, kth_first, mid);
+                first = *mid + 1;
+                kth_first = mid + 1;
             }
         }
 
-        template <class S, class I>
-        inline auto select_indices(const S& shape, const I& indices, std::size_t axis)
-        {
-            using index_type = get_strides_t<S>;
-            auto out = std::vector<index_type>();
-            select_indices_impl(shape, indices, axis, 0, xtl::make_sequence<index_type>(shape.size()), out);
-            return out;
-        }
-
-        // TODO remove when fancy index views are implemented
-        // Poor man's indexing along a single axis as in NumPy a[:, [1, 3, 4]]
-        template <class E, class I>
-        inline auto fancy_indexing(E&& e, const I& indices, std::ptrdiff_t axis)
+        /**
+         * Stores in res m values computed from each lane along the axis ax of the dense
+         * tensor ev, such as its quantiles. The first axis of res holds the values of a
+         * lane, unless m is 1, and its other axes are those of ev but ax, in the layout
+         * of ev.
+         *
+         * The lanes are gathered by blocks into a scratch buffer, as by
+         * call_over_strided_axis, and split between the threads of the policy. In each
+         * lane, the elements at the positions kth, sorted and unique, are selected with
+         * nested_select; value(lane, p) then computes the p-th value of the lane.
+         */
+        template <class R, class E, class F>
+        inline void select_over_axis(
+            const execution_policy& policy,
+            R& res,
+            const E& ev,
+            std::size_t ax,
+            const std::vector<std::size_t>& kth,
+            std::size_t m,
+            F&& value
+        )
         {
-            const std::size_t ax = normalize_axis(e.dimension(), axis);
-            using shape_t = get_strides_t<typename std::decay_t<E>::shape_type>;
-            auto shape = xtl::forward_sequence<shape_t, decltype(e.shape())>(e.shape());
-            shape[ax] = indices.size();
-            return reshape_view(
-                index_view(std::forward<E>(e), select_indices(e.shape(), indices, ax)),
-                std::move(shape)
+            using value_type = typename E::value_type;
+            XTENSOR_ASSERT(res.layout() == ev.layout());
+            const strided_lanes lanes = get_strided_lanes(ev, ax);
+            const std::size_t n = lanes.n;
+            const std::size_t lane_block = n * lanes.inner;
+            // The p-th value of the lane l is at p * value_stride + l * lane_stride in res
+            const bool row_major = ev.layout() == layout_type::row_major;
+            const std::size_t value_stride = row_major ? lanes.outer * lanes.inner : std::size_t(1);
+            const std::size_t lane_stride = row_major ? std::size_t(1) : m;
+            const value_type* data = ev.data();
+            auto* out = res.data();
+            for_each_lane_block(
+                policy,
+                lanes,
+                sizeof(value_type),
+                [&](std::size_t offset, std::size_t width, const execution_policy&)
+                {
+                    std::vector<value_type> owned;
+                    value_type* buffer = sort_scratch<2>(owned, width * n);
+                    gather_lanes(data + offset, buffer, n, lanes.inner, width);
+                    const std::size_t first_lane = offset / lane_block * lanes.inner + offset % lane_block;
+                    for (std::size_t j = 0; j < width; ++j)
+                    {
+                        value_type* lane = buffer + j * n;
+                        nested_select(lane, std::size_t(0), n, kth.cbegin(), kth.cend());
+                        for (std::size_t p = 0; p < m; ++p)
+                        {
+                            out[p * value_stride + (first_lane + j) * lane_stride] = value(lane, p);
+                        }
+                    }
+                }
             );
         }
 
@@ -856,16 +2042,6 @@ namespace xt
             const auto omg_g = concatenate(xtuple(T(1) - (p_n_m - j), p_n_m - j));
             return std::make_pair(eval(k_kp1), eval(omg_g));
         }
-
-        // TODO should implement unsqueeze rather
-        template <class S>
-        inline auto unsqueeze_shape(const S& shape, std::size_t axis)
-        {
-            XTENSOR_ASSERT(axis <= shape.size());
-            auto new_shape = xtl::forward_sequence<xt::svector<std::size_t>, decltype(shape)>(shape);
-            new_shape.insert(new_shape.begin() + axis, 1);
-            return new_shape;
-        }
     }
 
     /**
@@ -878,7 +2054,9 @@ namespace xt
      * computed using the @p alpha and @p beta coefficients, as descripted in
      * (Hyndman and Fan, 1996).
      *
-     * The algorithm partially sorts entries in a copy along the @p axis axis.
+     * The values needed for the quantiles of a lane along @p axis are selected in a
+     * copy of the lane only, all the quantiles of the lane being computed at once.
+     * The lanes are split between the threads of the execution policy.
      *
      * @ingroup xt_xsort
      * @param e Expression containing the distribution over which the quantiles are computed.
@@ -888,6 +2066,7 @@ namespace xt
      *        distribution.
      * @param alpha Interpolation parameter. Must be in the range ``[0, 1]]``.
      * @param beta Interpolation parameter. Must be in the range ``[0, 1]]``.
+     * @param policy execution policy deciding whether the lanes are processed in parallel.
      * @tparam T The type in which the quantile are computed.
      * @return An expression with as many dimensions as the input @p e.
      *         The first axis correspond to the quantiles.
@@ -898,7 +2077,14 @@ namespace xt
      * @see https://en.wikipedia.org/wiki/Quantile
      */
     template <class T = double, class E, class P>
-    inline auto quantile(E&& e, const P& probas, std::ptrdiff_t axis, T alpha, T beta)
+    inline auto quantile(
+        E&& e,
+        const P& probas,
+        std::ptrdiff_t axis,
+        T alpha,
+        T beta,
+        const execution_policy& policy = execution::default_policy
+    )
     {
         XTENSOR_ASSERT(all(0. <= probas));
         XTENSOR_ASSERT(all(probas <= 1.));
@@ -907,39 +2093,58 @@ namespace xt
         XTENSOR_ASSERT(0. <= beta);
         XTENSOR_ASSERT(beta <= 1.);
 
-        using tmp_shape_t = get_strides_t<typename std::decay_t<E>::shape_type>;
-        using id_t = typename tmp_shape_t::value_type;
-
-        const std::size_t ax = normalize_axis(e.dimension(), axis);
-        const std::size_t n = e.shape()[ax];
-        auto kth_gamma = detail::quantile_kth_gamma<T, id_t, P>(n, probas, alpha, beta);
-
-        // Select relevant values for computing interpolating quantiles
-        auto e_partition = xt::partition(std::forward<E>(e), kth_gamma.first, ax);
-        auto e_kth = detail::fancy_indexing(std::move(e_partition), std::move(kth_gamma.first), ax);
-
-        // Reshape interpolation coefficients
-        auto gm1_g_shape = xtl::make_sequence<tmp_shape_t>(e.dimension(), 1);
-        gm1_g_shape[ax] = kth_gamma.second.size();
-        auto gm1_g_reshaped = reshape_view(std::move(kth_gamma.second), std::move(gm1_g_shape));
-
-        // Compute interpolation
-        // TODO(C++20) use (and create) xt::lerp in C++
-        auto e_kth_g = std::move(e_kth) * std::move(gm1_g_reshaped);
-        // Reshape pairwise interpolate for suming along new axis
-        auto e_kth_g_shape = detail::unsqueeze_shape(e_kth_g.shape(), ax);
-        e_kth_g_shape[ax] = 2;
-        e_kth_g_shape[ax + 1] /= 2;
-        auto quantiles = xt::sum(reshape_view(std::move(e_kth_g), std::move(e_kth_g_shape)), ax);
-        // Cannot do a transpose on a non-strided expression so we have to eval
-        return moveaxis(eval(std::move(quantiles)), ax, 0);
+        using eval_type = typename detail::sort_eval_type<std::decay_t<E>>::type;
+        using value_type = typename eval_type::value_type;
+        using quantile_type = std::decay_t<decltype(std::declval<value_type>() * std::declval<T>())>;
+        using result_type = typename detail::rebind_value_type<quantile_type, eval_type>::type;
+
+        detail::sort_operand_t<E, eval_type> ev = e;
+        const std::size_t ax = normalize_axis(ev.dimension(), axis);
+        const std::size_t n = ev.shape()[ax];
+        const std::size_t m = probas.size();
+        const auto kth_gamma = detail::quantile_kth_gamma<T, std::size_t, P>(n, probas, alpha, beta);
+        const auto& kth = kth_gamma.first;
+        const auto& gamma = kth_gamma.second;
+
+        // Positions of the values to interpolate, the same in all the lanes
+        std::vector<std::size_t> positions(kth.cbegin(), kth.cend());
+        std::sort(positions.begin(), positions.end());
+        positions.erase(std::unique(positions.begin(), positions.end()), positions.end());
+
+        auto shape = xtl::make_sequence<typename result_type::shape_type>(ev.dimension(), std::size_t(0));
+        shape[0] = m;
+        const auto axis_it = ev.shape().cbegin() + static_cast<std::ptrdiff_t>(ax);
+        std::copy(axis_it + 1, ev.shape().cend(), std::copy(ev.shape().cbegin(), axis_it, shape.begin() + 1));
+        result_type res;
+        res.resize(std::move(shape), ev.layout());
+        detail::select_over_axis(
+            policy,
+            res,
+            ev,
+            ax,
+            positions,
+            m,
+            [&kth, &gamma, m](const value_type* lane, std::size_t p)
+            {
+                // TODO(C++20) use (and create) xt::lerp in C++
+                return lane[kth(p)] * gamma(p) + lane[kth(p + m)] * gamma(p + m);
+            }
+        );
+        return res;
     }
 
     // Static proba array overload
     template <class T = double, class E, std::size_t N>
-    inline auto quantile(E&& e, const T (&probas)[N], std::ptrdiff_t axis, T alpha, T beta)
+    inline auto quantile(
+        E&& e,
+        const T (&probas)[N],
+        std::ptrdiff_t axis,
+        T alpha,
+        T beta,
+        const execution_policy& policy = execution::default_policy
+    )
     {
-        return quantile(std::forward<E>(e), adapt(probas, {N}), axis, alpha, beta);
+        return quantile(std::forward<E>(e), adapt(probas, {N}), axis, alpha, beta, policy);
     }
 
     /**
@@ -1001,8 +2206,13 @@ namespace xt
      * @see xt::quantile(E&& e, P const& probas, std::ptrdiff_t axis, T alpha, T beta)
      */
     template <class T = double, class E, class P>
-    inline auto
-    quantile(E&& e, const P& probas, std::ptrdiff_t axis, quantile_method method = quantile_method::linear)
+    inline auto quantile(
+        E&& e,
+        const P& probas,
+        std::ptrdiff_t axis,
+        quantile_method method = quantile_method::linear,
+        const execution_policy& policy = execution::default_policy
+    )
     {
         T alpha = 0.;
         T beta = 0.;
@@ -1045,15 +2255,20 @@ namespace xt
                 break;
             }
         }
-        return quantile(std::forward<E>(e), probas, axis, alpha, beta);
+        return quantile(std::forward<E>(e), probas, axis, alpha, beta, policy);
     }
 
     // Static proba array overload
     template <class T = double, class E, std::size_t N>
-    inline auto
-    quantile(E&& e, const T (&probas)[N], std::ptrdiff_t axis, quantile_method method = quantile_method::linear)
+    inline auto quantile(
+        E&& e,
+        const T (&probas)[N],
+        std::ptrdiff_t axis,
+        quantile_method method = quantile_method::linear,
+        const execution_policy& policy = execution::default_policy
+    )
     {
-        return quantile(std::forward<E>(e), adapt(probas, {N}), axis, method);
+        return quantile(std::forward<E>(e), adapt(probas, {N}), axis, method, policy);
     }
 
     /**
@@ -1118,28 +2333,57 @@ namespace xt
      * @return median value
      */
     template <class E>
-    inline auto median(E&& e, std::ptrdiff_t axis)
+    inline auto
+    median(E&& e, std::ptrdiff_t axis, const execution_policy& policy = execution::default_policy)
     {
-        std::size_t ax = normalize_axis(e.dimension(), axis);
-        std::size_t sz = e.shape()[ax];
-        xstrided_slice_vector sv(e.dimension(), xt::all());
-
+        using eval_type = typename detail::sort_eval_type<std::decay_t<E>>::type;
+        using value_type = typename eval_type::value_type;
+        using mean_type = typename std::decay_t<
+            decltype(xt::mean(std::declval<const eval_type&>(), {std::size_t(0)}))>::value_type;
+        using result_type = typename detail::reduce_rebind_value_type<mean_type, eval_type>::type;
+
+        detail::sort_operand_t<E, eval_type> ev = e;
+        const std::size_t ax = normalize_axis(ev.dimension(), axis);
+        const std::size_t sz = ev.shape()[ax];
+        const std::size_t szh = sz / 2;  // integer floor div
+
+        auto shape = xtl::make_sequence<typename result_type::shape_type>(ev.dimension() - 1, std::size_t(0));
+        const auto axis_it = ev.shape().cbegin() + static_cast<std::ptrdiff_t>(ax);
+        std::copy(axis_it + 1, ev.shape().cend(), std::copy(ev.shape().cbegin(), axis_it, shape.begin()));
+        result_type res;
+        res.resize(std::move(shape), ev.layout());
         if (sz % 2 == 0)
         {
-            std::size_t szh = sz / 2;  // integer floor div
-            std::array<std::size_t, 2> kth = {szh - 1, szh};
-            auto values = xt::partition(std::forward<E>(e), kth, static_cast<ptrdiff_t>(ax));
-            sv[ax] = xt::range(szh - 1, szh + 1);
-            return xt::mean(xt::strided_view(std::move(values), std::move(sv)), {ax});
+            detail::select_over_axis(
+                policy,
+                res,
+                ev,
+                ax,
+                {szh - 1, szh},
+                1,
+                [szh](const value_type* lane, std::size_t)
+                {
+                    return (static_cast<mean_type>(lane[szh - 1]) + static_cast<mean_type>(lane[szh]))
+                           / mean_type(2);
+                }
+            );
         }
         else
         {
-            std::size_t szh = (sz - 1) / 2;
-            std::array<std::size_t, 1> kth = {(sz - 1) / 2};
-            auto values = xt::partition(std::forward<E>(e), kth, static_cast<ptrdiff_t>(ax));
-            sv[ax] = xt::range(szh, szh + 1);
-            return xt::mean(xt::strided_view(std::move(values), std::move(sv)), {ax});
+            detail::select_over_axis(
+                policy,
+                res,
+                ev,
+                ax,
+                {szh},
+                1,
+                [szh](const value_type* lane, std::size_t)
+                {
+                    return static_cast<mean_type>(lane[szh]);
+                }
+            );
         }
+        return res;
     }
 
     namespace detail
@@ -1156,29 +2400,145 @@ namespace xt
             using type = xtensor<std::size_t, N - 1>;
         };
 
+        // Largest count of iterations represented exactly by the values of type T
+        template <class T>
+        constexpr std::size_t exact_count_limit()
+        {
+            constexpr std::size_t limit = std::size_t(1) << 30;
+            if constexpr (std::is_floating_point<T>::value)
+            {
+                return std::size_t(1) << std::min(std::numeric_limits<T>::digits - 1, 30);
+            }
+            else
+            {
+                return std::min(static_cast<std::size_t>(std::numeric_limits<T>::max()), limit);
+            }
+        }
+
+        /**
+         * Returns the value and the position of the first element of [first, last)
+         * of \p data which compares before \p val with \p cmp and before all the
+         * other ones, or (\p val, \p idx) if there is none.
+         *
+         * When the values have SIMD batches, each lane keeps its best value and the
+         * iteration where it found it, as a value of the batch so that both vectors
+         * are updated with the same mask. The iterations are split in blocks whose
+         * count is exactly represented in the value type; the lanes are reduced
+         * horizontally at the end of each block.
+         */
+        template <class T, class F>
+        inline std::pair<T, std::size_t>
+        arg_extremum(const T* data, std::size_t first, std::size_t last, T val, std::size_t idx, F cmp)
+        {
+            std::size_t i = first;
+            if constexpr (has_simd_type<T>::value && !std::is_same<T, bool>::value)
+            {
+                using batch_type = xt_simd::simd_type<T>;
+                constexpr std::size_t simd_size = xt_simd::simd_traits<T>::size;
+                constexpr std::size_t max_block_iters = exact_count_limit<T>();
+                T lane_val[simd_size];
+                T lane_iter[simd_size];
+                while (last - i >= simd_size)
+                {
+                    const std::size_t nb_iters = std::min((last - i) / simd_size, max_block_iters);
+                    batch_type best = xt_simd::broadcast_as<T>(val);
+                    batch_type best_iter = xt_simd::broadcast_as<T>(T(0));
+                    for (std::size_t k = 0; k < nb_iters; ++k)
+                    {
+                        const T* block = data + i + k * simd_size;
+                        batch_type x = xt_simd::load_as<T>(block, xt_simd::unaligned_mode());
+                        auto better = cmp(x, best);
+                        best = xt_simd::select(better, x, best);
+                        best_iter = xt_simd::select(better, batch_type(static_cast<T>(k)), best_iter);
+                    }
+                    xt_simd::store_as(lane_val, best, xt_simd::unaligned_mode());
+                    xt_simd::store_as(lane_iter, best_iter, xt_simd::unaligned_mode());
+
+                    // Lanes which did not find anything better than val still hold it
+                    // and are skipped; equal values are resolved by their position.
+                    T block_val = val;
+                    std::size_t block_idx = idx;
+                    for (std::size_t j = 0; j < simd_size; ++j)
+                    {
+                        const std::size_t pos = i + static_cast<std::size_t>(lane_iter[j]) * simd_size + j;
+                        const bool first_better = cmp(lane_val[j], block_val)
+                                                  || (!cmp(block_val, lane_val[j]) && pos < block_idx);
+                        if (cmp(lane_val[j], val) && first_better)
+                        {
+                            block_val = lane_val[j];
+                            block_idx = pos;
+                        }
+                    }
+                    val = block_val;
+                    idx = block_idx;
+                    i += nb_iters * simd_size;
+                }
+            }
+            for (; i < last; ++i)
+            {
+                if (cmp(data[i], val))
+                {
+                    val = data[i];
+                    idx = i;
+                }
+            }
+            return {val, idx};
+        }
+
+        /**
+         * Returns the position of the first extremum of the \p n elements starting
+         * at \p data. Large ranges are split in one chunk per thread of the policy;
+         * every chunk starts from the first element so that the result does not
+         * depend on the chunks, even with NaN values.
+         */
+        template <class T, class F>
+        inline std::size_t
+        arg_extremum_range(const execution_policy& policy, const T* data, std::size_t n, F cmp)
+        {
+            if (n == std::size_t(0))
+            {
+                return 0;
+            }
+            using result_type = std::pair<T, std::size_t>;
+            auto chunk = [data, cmp](std::size_t first, std::size_t last)
+            {
+                first = std::max(first, std::size_t(1));
+                return arg_extremum(data, first, last, data[0], std::size_t(0), cmp);
+            };
+            if (!policy.use_parallel(n, 1))
+            {
+                return chunk(std::size_t(0), n).second;
+            }
+            auto merge = [cmp](result_type lhs, result_type rhs)
+            {
+                return cmp(rhs.first, lhs.first) ? rhs : lhs;
+            };
+            const std::size_t grain = policy.grain_size(1);
+            return parallel_reduce<result_type>(policy, std::size_t(0), n, chunk, merge, grain).second;
+        }
+
+        template <layout_type L, class E, class F>
+        inline std::size_t arg_func_flat(const E& e, F cmp)
+        {
+            if (e.is_contiguous() && (e.dimension() <= 1 || e.layout() == L))
+            {
+                return arg_extremum_range(execution::default_policy, e.data(), e.size(), cmp);
+            }
+            auto begin = e.template begin<L>();
+            auto end = e.template end<L>();
+            return static_cast<std::size_t>(std::distance(begin, std::min_element(begin, end, cmp)));
+        }
+
         template <layout_type L, class E, class F>
         inline typename argfunc_result_type<E>::type arg_func_impl(const E& e, std::size_t axis, F&& cmp)
         {
             using eval_type = typename detail::sort_eval_type<E>::type;
-            using value_type = typename E::value_type;
             using result_type = typename argfunc_result_type<E>::type;
             using result_shape_type = typename result_type::shape_type;
 
             if (e.dimension() == 1)
             {
-                auto begin = e.template begin<L>();
-                auto end = e.template end<L>();
-                // todo C++17 : constexpr
-                if (std::is_same<F, std::less<value_type>>::value)
-                {
-                    std::size_t i = static_cast<std::size_t>(std::distance(begin, std::min_element(begin, end)));
-                    return xtensor<size_t, 0>{i};
-                }
-                else
-                {
-                    std::size_t i = static_cast<std::size_t>(std::distance(begin, std::max_element(begin, end)));
-                    return xtensor<size_t, 0>{i};
-                }
+                return xtensor<size_t, 0>{arg_func_flat<L>(e, cmp)};
             }
 
             result_shape_type alt_shape;
@@ -1193,23 +2553,56 @@ namespace xt
             );
 
             result_type result = result_type::from_shape(std::move(alt_shape));
-            auto result_iter = result.template begin<L>();
 
-            auto arg_func_lambda = [&result_iter, &cmp](auto begin, auto end)
+            // The rows along the leading axis are contiguous; their results are
+            // stored in the traversal order L of the result.
+            auto arg_func_rows = [&result, &cmp](const auto& input)
             {
-                std::size_t idx = 0;
-                value_type val = *begin;
-                ++begin;
-                for (std::size_t i = 1; begin != end; ++begin, ++i)
+                const std::size_t row_size = input.shape()[leading_axis(input)];
+                const std::size_t nb_rows = leading_axis_n_iters(input);
+                if (row_size == std::size_t(0) || nb_rows == std::size_t(0))
+                {
+                    return;
+                }
+                const auto* data = input.data();
+                std::vector<std::size_t> buffer;
+                std::size_t* out = result.data();
+                if (result.layout() != L)
+                {
+                    buffer.resize(nb_rows);
+                    out = buffer.data();
+                }
+
+                const execution_policy& policy = execution::default_policy;
+                if (policy.use_parallel(nb_rows * row_size, 1) && nb_rows >= policy.concurrency())
+                {
+                    parallel_for(
+                        policy,
+                        std::size_t(0),
+                        nb_rows,
+                        [&](std::size_t first, std::size_t last)
+                        {
+                            for (std::size_t r = first; r < last; ++r)
+                            {
+                                const auto* row = data + r * row_size;
+                                out[r] = arg_extremum_range(execution::seq, row, row_size, cmp);
+                            }
+                        },
+                        policy.grain_size(row_size)
+                    );
+                }
+                else
                 {
-                    if (cmp(*begin, val))
+                    for (std::size_t r = 0; r < nb_rows; ++r)
                     {
-                        val = *begin;
-                        idx = i;
+                        out[r] = arg_extremum_range(policy, data + r * row_size, row_size, cmp);
                     }
                 }
-                *result_iter = idx;
-                ++result_iter;
+
+                if (!buffer.empty())
+                {
+                    std::copy(buffer.cbegin(), buffer.cend(), result.template begin<L>());
+                }
             };
 
             if (axis != detail::leading_axis(e))
@@ -1222,13 +2615,13 @@ namespace xt
 
                 // note: creating copy
                 eval_type input = transpose(e, permutation);
-                detail::call_over_leading_axis(input, arg_func_lambda);
+                arg_func_rows(input);
                 return result;
             }
             else
             {
                 auto&& input = eval(e);
-                detail::call_over_leading_axis(input, arg_func_lambda);
+                arg_func_rows(input);
                 return result;
             }
         }
@@ -1237,12 +2630,8 @@ namespace xt
     template <layout_type L = XTENSOR_DEFAULT_TRAVERSAL, class E>
     inline auto argmin(const xexpression<E>& e)
     {
-        using value_type = typename E::value_type;
         auto&& ed = eval(e.derived_cast());
-        auto begin = ed.template begin<L>();
-        auto end = ed.template end<L>();
-        std::size_t i = static_cast<std::size_t>(std::distance(begin, std::min_element(begin, end)));
-        return xtensor<size_t, 0>{i};
+        return xtensor<size_t, 0>{detail::arg_func_flat<L>(ed, std::less<>())};
     }
 
     /**
@@ -1258,21 +2647,16 @@ namespace xt
     template <layout_type L = XTENSOR_DEFAULT_TRAVERSAL, class E>
     inline auto argmin(const xexpression<E>& e, std::ptrdiff_t axis)
     {
-        using value_type = typename E::value_type;
         auto&& ed = eval(e.derived_cast());
         std::size_t ax = normalize_axis(ed.dimension(), axis);
-        return detail::arg_func_impl<L>(ed, ax, std::less<value_type>());
+        return detail::arg_func_impl<L>(ed, ax, std::less<>());
     }
 
     template <layout_type L = XTENSOR_DEFAULT_TRAVERSAL, class E>
     inline auto argmax(const xexpression<E>& e)
     {
-        using value_type = typename E::value_type;
         auto&& ed = eval(e.derived_cast());
-        auto begin = ed.template begin<L>();
-        auto end = ed.template end<L>();
-        std::size_t i = static_cast<std::size_t>(std::distance(begin, std::max_element(begin, end)));
-        return xtensor<size_t, 0>{i};
+        return xtensor<size_t, 0>{detail::arg_func_flat<L>(ed, std::greater<>())};
     }
 
     /**
@@ -1289,10 +2673,9 @@ namespace xt
     template <layout_type L = XTENSOR_DEFAULT_TRAVERSAL, class E>
     inline auto argmax(const xexpression<E>& e, std::ptrdiff_t axis)
     {
-        using value_type = typename E::value_type;
         auto&& ed = eval(e.derived_cast());
         std::size_t ax = normalize_axis(ed.dimension(), axis);
-        return detail::arg_func_impl<L>(ed, ax, std::greater<value_type>());
+        return detail::arg_func_impl<L>(ed, ax, std::greater<>());
     }
 
     /**
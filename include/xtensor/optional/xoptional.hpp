@@ -265,7 +265,12 @@ namespace xt
     public:
 
         template <class E1, class E2>
-        static void assign_data(xexpression<E1>& e1, const xexpression<E2>& e2, bool trivial);
+        static void assign_data(
+            xexpression<E1>& e1,
+            const xexpression<E2>& e2,
+            bool trivial,
+            const execution_policy& policy = execution::default_policy
+        );
     };
 
     /**********************************
@@ -1280,15 +1285,21 @@ namespace xt
         struct assign_data_impl
         {
             template <class E1, class E2>
-            static void run(xexpression<E1>& e1, const xexpression<E2>& e2, bool trivial)
+            static void
+            run(xexpression<E1>& e1, const xexpression<E2>& e2, bool trivial, const execution_policy& policy)
             {
                 E1& de1 = e1.derived_cast();
                 const E2& de2 = e2.derived_cast();
 
                 decltype(auto) bde1 = xt::value(de1);
                 decltype(auto) hde1 = xt::has_value(de1);
-                xexpression_assigner_base<xtensor_expression_tag>::assign_data(bde1, xt::value(de2), trivial);
-                xexpression_assigner_base<xtensor_expression_tag>::assign_data(hde1, xt::has_value(de2), trivial);
+                xexpression_assigner_base<xtensor_expression_tag>::assign_data(bde1, xt::value(de2), trivial, policy);
+                xexpression_assigner_base<xtensor_expression_tag>::assign_data(
+                    hde1,
+                    xt::has_value(de2),
+                    trivial,
+                    policy
+                );
             }
         };
 
@@ -1296,7 +1307,8 @@ namespace xt
         struct xarray_assigner
         {
             template <class E1, class E2>
-            static void assign(xexpression<E1>& e1, const xexpression<E2>& e2, bool trivial)
+            static void
+            assign(xexpression<E1>& e1, const xexpression<E2>& e2, bool trivial, const execution_policy& policy)
             {
                 E1& de1 = e1.derived_cast();
                 const E2& de2 = e2.derived_cast();
@@ -1304,8 +1316,8 @@ namespace xt
 
                 decltype(auto) bde1 = xt::value(de1);
                 decltype(auto) hde1 = xt::has_value(de1);
-                xexpression_assigner_base<xtensor_expression_tag>::assign_data(bde1, e2, trivial);
-                xexpression_assigner_base<xtensor_expression_tag>::assign_data(hde1, mask, trivial);
+                xexpression_assigner_base<xtensor_expression_tag>::assign_data(bde1, e2, trivial, policy);
+                xexpression_assigner_base<xtensor_expression_tag>::assign_data(hde1, mask, trivial, policy);
             }
         };
 
@@ -1313,9 +1325,10 @@ namespace xt
         struct xarray_assigner<xtl::xoptional<T>>
         {
             template <class E1, class E2>
-            static void assign(xexpression<E1>& e1, const xexpression<E2>& e2, bool trivial)
+            static void
+            assign(xexpression<E1>& e1, const xexpression<E2>& e2, bool trivial, const execution_policy& policy)
             {
-                xexpression_assigner_base<xtensor_expression_tag>::assign_data(e1, e2, trivial);
+                xexpression_assigner_base<xtensor_expression_tag>::assign_data(e1, e2, trivial, policy);
             }
         };
 
@@ -1323,9 +1336,10 @@ namespace xt
         struct assign_data_impl<xoptional_expression_tag, xtensor_expression_tag>
         {
             template <class E1, class E2>
-            static void run(xexpression<E1>& e1, const xexpression<E2>& e2, bool trivial)
+            static void
+            run(xexpression<E1>& e1, const xexpression<E2>& e2, bool trivial, const execution_policy& policy)
             {
-                xarray_assigner<typename E2::value_type>::assign(e1, e2, trivial);
+                xarray_assigner<typename E2::value_type>::assign(e1, e2, trivial, policy);
             }
         };
 
@@ -1333,9 +1347,10 @@ namespace xt
         struct assign_data_impl<xtensor_expression_tag, xoptional_expression_tag>
         {
             template <class E1, class E2>
-            static void run(xexpression<E1>& e1, const xexpression<E2>& e2, bool trivial)
+            static void
+            run(xexpression<E1>& e1, const xexpression<E2>& e2, bool trivial, const execution_policy& policy)
             {
-                xexpression_assigner_base<xtensor_expression_tag>::assign_data(e1, e2, trivial);
+                xexpression_assigner_base<xtensor_expression_tag>::assign_data(e1, e2, trivial, policy);
             }
         };
     }
@@ -1344,10 +1359,16 @@ namespace xt
     inline void xexpression_assigner_base<xoptional_expression_tag>::assign_data(
         xexpression<E1>& e1,
         const xexpression<E2>& e2,
-        bool trivial
+        bool trivial,
+        const execution_policy& policy
     )
     {
-        detail::assign_data_impl<typename E1::expression_tag, typename E2::expression_tag>::run(e1, e2, trivial);
+        detail::assign_data_impl<typename E1::expression_tag, typename E2::expression_tag>::run(
+            e1,
+            e2,
+            trivial,
+            policy
+        );
     }
 }
 
@@ -14,11 +14,15 @@
 #include <cstddef>
 #include <numeric>
 #include <type_traits>
+#include <vector>
 
+#include "../core/xexecution.hpp"
 #include "../core/xexpression.hpp"
 #include "../core/xstrides.hpp"
 #include "../core/xtensor_config.hpp"
 #include "../core/xtensor_forward.hpp"
+#include "../reducers/xreducer.hpp"
+#include "../utils/xtensor_simd.hpp"
 
 namespace xt
 {
@@ -212,6 +216,222 @@ namespace xt
             }
         }
 
+        /**
+         * Scans the \p n consecutive elements starting at \p data in place, i.e.
+         * replaces each of them with its accumulation with the previous ones.
+         */
+        template <class F, class T>
+        inline void scan_range(F& f, T* data, std::size_t n)
+        {
+            for (std::size_t k = 1; k < n; ++k)
+            {
+                data[k] = f(data[k - 1], data[k]);
+            }
+        }
+
+        /**
+         * Replaces the elements [first, last) of \p data with their accumulation
+         * with \p carry, by batches when \c f can be applied on SIMD registers.
+         */
+        template <class F, class T>
+        inline void scan_carry(F& f, const T& carry, T* data, std::size_t first, std::size_t last)
+        {
+            std::size_t k = first;
+            if constexpr (has_simd_reduce<F, T>::value)
+            {
+                constexpr std::size_t simd_size = xt_simd::simd_traits<T>::size;
+                const auto carry_batch = xt_simd::broadcast_as<T>(carry);
+                for (; k + simd_size <= last; k += simd_size)
+                {
+                    auto batch = xt_simd::load_as<T>(data + k, xt_simd::unaligned_mode());
+                    xt_simd::store_as(data + k, f.simd_apply(carry_batch, batch), xt_simd::unaligned_mode());
+                }
+            }
+            for (; k < last; ++k)
+            {
+                data[k] = f(carry, data[k]);
+            }
+        }
+
+        /**
+         * Scans the \p n consecutive elements starting at \p data with the
+         * associative functor \c f in two phases: the chunks of the range are first
+         * scanned independently, then each chunk is accumulated with the total of the
+         * previous ones. Both phases run in parallel.
+         */
+        template <class F, class T>
+        inline void
+        parallel_scan_range(const execution_policy& policy, F& f, T* data, std::size_t n, std::size_t grain)
+        {
+            const std::size_t nb_chunks = std::min(policy.concurrency(), n / std::max(grain, std::size_t(1)));
+            if (nb_chunks < 2)
+            {
+                scan_range(f, data, n);
+                return;
+            }
+
+            auto chunk_begin = [n, nb_chunks](std::size_t i)
+            {
+                return n * i / nb_chunks;
+            };
+
+            parallel_for(
+                policy,
+                std::size_t(0),
+                nb_chunks,
+                [&](std::size_t first, std::size_t last)
+                {
+                    for (std::size_t i = first; i < last; ++i)
+                    {
+                        scan_range(f, data + chunk_begin(i), chunk_begin(i + 1) - chunk_begin(i));
+                    }
+                }
+            );
+
+            // carries[i] is the accumulation of the chunks preceding the chunk i
+            std::vector<T> carries(nb_chunks);
+            carries[1] = data[chunk_begin(1) - 1];
+            for (std::size_t i = 2; i < nb_chunks; ++i)
+            {
+                carries[i] = f(carries[i - 1], data[chunk_begin(i) - 1]);
+            }
+
+            parallel_for(
+                policy,
+                std::size_t(1),
+                nb_chunks,
+                [&](std::size_t first, std::size_t last)
+                {
+                    for (std::size_t i = first; i < last; ++i)
+                    {
+                        scan_carry(f, carries[i], data, chunk_begin(i), chunk_begin(i + 1));
+                    }
+                }
+            );
+        }
+
+        /**
+         * Scans the lanes [first_lane, last_lane) of the \p n rows of \p inner
+         * elements starting at \p data, i.e. accumulates each row with the previous
+         * one. The lanes are independent: they are processed by batches when \c f
+         * can be applied on SIMD registers, and by tiles so that the previous and the
+         * current rows of a tile stay in the L1 cache.
+         */
+        template <class F, class T>
+        inline void scan_lanes(
+            F& f,
+            T* data,
+            std::size_t n,
+            std::size_t inner,
+            std::size_t first_lane,
+            std::size_t last_lane
+        )
+        {
+            constexpr std::size_t tile_size = std::max(
+                std::size_t(XTENSOR_L1_CACHE_SIZE) / (2 * sizeof(T)),
+                std::size_t(1)
+            );
+            for (std::size_t tile = first_lane; tile < last_lane; tile += tile_size)
+            {
+                const std::size_t tile_end = std::min(tile + tile_size, last_lane);
+                for (std::size_t k = 1; k < n; ++k)
+                {
+                    const T* prev = data + (k - 1) * inner;
+                    T* cur = data + k * inner;
+                    std::size_t j = tile;
+                    if constexpr (has_simd_reduce<F, T>::value)
+                    {
+                        constexpr std::size_t simd_size = xt_simd::simd_traits<T>::size;
+                        for (; j + simd_size <= tile_end; j += simd_size)
+                        {
+                            auto lhs = xt_simd::load_as<T>(prev + j, xt_simd::unaligned_mode());
+                            auto rhs = xt_simd::load_as<T>(cur + j, xt_simd::unaligned_mode());
+                            xt_simd::store_as(cur + j, f.simd_apply(lhs, rhs), xt_simd::unaligned_mode());
+                        }
+                    }
+                    for (; j < tile_end; ++j)
+                    {
+                        cur[j] = f(prev[j], cur[j]);
+                    }
+                }
+            }
+        }
+
+        /**
+         * Scans in place the \p outer contiguous blocks of \p n rows of \p inner
+         * elements starting at \p data along their rows. With the default execution
+         * policy, the blocks are scanned in parallel when there are enough of them,
+         * otherwise the lanes of each block are split between the threads, or the
+         * single lane is scanned in parallel when \c f is associative.
+         */
+        template <class F, class T>
+        inline void scan_axis(F& f, T* data, std::size_t outer, std::size_t n, std::size_t inner)
+        {
+            // prev = f(prev, cur) costs 2 units per element: 2 loads and 1 store amortized
+            constexpr std::size_t cost = 2;
+            const execution_policy& policy = execution::default_policy;
+            const std::size_t block_size = n * inner;
+
+            auto scan_blocks = [&](std::size_t first, std::size_t last)
+            {
+                for (std::size_t i = first; i < last; ++i)
+                {
+                    T* block = data + i * block_size;
+                    if (inner == 1)
+                    {
+                        scan_range(f, block, n);
+                    }
+                    else
+                    {
+                        scan_lanes(f, block, n, inner, std::size_t(0), inner);
+                    }
+                }
+            };
+
+            if (!policy.use_parallel(outer * block_size, cost))
+            {
+                scan_blocks(std::size_t(0), outer);
+            }
+            else if (outer >= policy.concurrency())
+            {
+                parallel_for(
+                    policy,
+                    std::size_t(0),
+                    outer,
+                    scan_blocks,
+                    policy.grain_size(cost * block_size)
+                );
+            }
+            else if (inner > 1)
+            {
+                for (std::size_t i = 0; i < outer; ++i)
+                {
+                    T* block = data + i * block_size;
+                    parallel_for(
+                        policy,
+                        std::size_t(0),
+                        inner,
+                        [&](std::size_t first, std::size_t last)
+                        {
+                            scan_lanes(f, block, n, inner, first, last);
+                        },
+                        policy.grain_size(cost * n)
+                    );
+                }
+            }
+            else if constexpr (is_associative_reducer<std::decay_t<F>>::value)
+            {
+                for (std::size_t i = 0; i < outer; ++i)
+                {
+                    parallel_scan_range(policy, f, data + i * n, n, policy.grain_size(cost));
+                }
+            }
+            else
+            {
+                scan_blocks(std::size_t(0), outer);
+            }
+        }
+
         template <class F, class E>
         inline auto accumulator_impl(F&& f, E&& e, std::size_t axis, evaluation_strategy::immediate_type)
         {
@@ -235,41 +455,8 @@ namespace xt
 
             result_type res = e;  // assign + make a copy, we need it anyways
 
-            if (res.shape(axis) != std::size_t(0))
+            if (res.size() != std::size_t(0))
             {
-                std::size_t inner_stride = static_cast<std::size_t>(res.strides()[axis]);
-                std::size_t outer_stride = 1;  // either row- or column-wise (strides.back / strides.front)
-                std::size_t outer_loop_size = 0;
-                std::size_t inner_loop_size = 0;
-                std::size_t init_size = e.shape()[axis] != std::size_t(1) ? std::size_t(1) : std::size_t(0);
-
-                auto set_loop_sizes =
-                    [&outer_loop_size, &inner_loop_size, init_size](auto first, auto last, std::ptrdiff_t ax)
-                {
-                    outer_loop_size = std::accumulate(first, first + ax, init_size, std::multiplies<std::size_t>());
-
-                    inner_loop_size = std::accumulate(
-                        first + ax,
-                        last,
-                        std::size_t(1),
-                        std::multiplies<std::size_t>()
-                    );
-                };
-
-                if (result_type::static_layout == layout_type::row_major)
-                {
-                    set_loop_sizes(res.shape().cbegin(), res.shape().cend(), static_cast<std::ptrdiff_t>(axis));
-                }
-                else
-                {
-                    set_loop_sizes(res.shape().cbegin(), res.shape().cend(), static_cast<std::ptrdiff_t>(axis + 1));
-                    std::swap(inner_loop_size, outer_loop_size);
-                }
-
-                std::size_t pos = 0;
-
-                inner_loop_size = inner_loop_size - inner_stride;
-
                 // activate the init loop if we have an init function other than identity
                 if (!std::is_same<
                         std::decay_t<typename F::init_functor_type>,
@@ -278,19 +465,14 @@ namespace xt
                     accumulator_init_with_f(xt::get<1>(f), res, axis);
                 }
 
-                pos = 0;
-                for (std::size_t i = 0; i < outer_loop_size; ++i)
+                // the container is contiguous: whatever its layout, it is made of outer
+                // blocks of n rows of inner elements, where the rows are along axis
+                const std::size_t n = res.shape(axis);
+                if (n > std::size_t(1))
                 {
-                    for (std::size_t j = 0; j < inner_loop_size; ++j)
-                    {
-                        res.storage()[pos + inner_stride] = xt::get<0>(f)(
-                            res.storage()[pos],
-                            res.storage()[pos + inner_stride]
-                        );
-
-                        pos += outer_stride;
-                    }
-                    pos += inner_stride;
+                    const std::size_t inner = static_cast<std::size_t>(res.strides()[axis]);
+                    const std::size_t outer = res.size() / (n * inner);
+                    scan_axis(xt::get<0>(f), res.data(), outer, n, inner);
                 }
             }
             return res;
@@ -318,13 +500,8 @@ namespace xt
             {
                 auto it = e.template begin<XTENSOR_DEFAULT_TRAVERSAL>();
                 result.storage()[0] = xt::get<1>(f)(*it);
-                ++it;
-
-                for (std::size_t idx = 0; it != e.template end<XTENSOR_DEFAULT_TRAVERSAL>(); ++it)
-                {
-                    result.storage()[idx + 1] = xt::get<0>(f)(result.storage()[idx], *it);
-                    ++idx;
-                }
+                std::copy(++it, e.template end<XTENSOR_DEFAULT_TRAVERSAL>(), result.storage().begin() + 1);
+                scan_axis(xt::get<0>(f), result.data(), std::size_t(1), sz, std::size_t(1));
             }
             return result;
         }
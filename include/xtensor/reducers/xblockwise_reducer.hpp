@@ -1,6 +1,9 @@
 #ifndef XTENSOR_XBLOCKWISE_REDUCER_HPP
 #define XTENSOR_XBLOCKWISE_REDUCER_HPP
 
+#include <vector>
+
+#include "../core/xexecution.hpp"
 #include "../core/xmultiindex_iterator.hpp"
 #include "../core/xshape.hpp"
 #include "../reducers/xblockwise_reducer_functors.hpp"
@@ -53,7 +56,16 @@ namespace xt
         using input_chunk_range_type = std::array<xmultiindex_iterator<input_chunk_index_type>, 2>;
 
         template <class CI>
-        void assign_to_chunk(CI& result_chunk_iter) const;
+        void assign_to_chunk(CI& result_chunk_iter, const execution_policy& policy) const;
+
+        template <class I, class E, class MR>
+        void merge_input_chunks(
+            const I& input_chunk_indices,
+            std::size_t first,
+            std::size_t last,
+            E& result,
+            MR& mr
+        ) const;
 
         template <class CI>
         input_chunk_range_type compute_input_chunk_range(CI& result_chunk_iter) const;
@@ -126,15 +138,55 @@ namespace xt
         return m_result_chunk_shape;
     }
 
+    /**
+     * Computes the result of the reduction in \p result. The output chunks are
+     * independent, so that they are computed in parallel when the execution policy
+     * of the reducer options is parallel and there are enough of them to keep all
+     * its threads busy. Otherwise, the input blocks of every output chunk are
+     * split among the threads, whose partial results are merged in order.
+     */
     template <class CT, class F, class X, class O>
     template <class R>
     inline void xblockwise_reducer<CT, F, X, O>::assign_to(R& result) const
     {
         auto result_chunked_view = as_chunked(result, m_result_chunk_shape);
+        using result_chunk_iterator = decltype(result_chunked_view.chunk_begin());
+        std::vector<result_chunk_iterator> result_chunk_iters;
         for (auto chunk_iter = result_chunked_view.chunk_begin(); chunk_iter != result_chunked_view.chunk_end();
              ++chunk_iter)
         {
-            assign_to_chunk(chunk_iter);
+            result_chunk_iters.push_back(chunk_iter);
+        }
+
+        // Reducing an element costs about a load and an operation
+        constexpr std::size_t reduce_cost = 2;
+        execution_policy policy = reducer_options<value_type, raw_options_type>(m_options).policy;
+        if (!policy.use_parallel(m_e.size(), reduce_cost))
+        {
+            policy = execution::seq;
+        }
+
+        if (policy.is_parallel() && result_chunk_iters.size() >= policy.concurrency())
+        {
+            detail::parallel_for(
+                policy,
+                std::size_t(0),
+                result_chunk_iters.size(),
+                [&](std::size_t first, std::size_t last)
+                {
+                    for (std::size_t i = first; i < last; ++i)
+                    {
+                        assign_to_chunk(result_chunk_iters[i], execution::seq);
+                    }
+                }
+            );
+        }
+        else
+        {
+            for (auto& chunk_iter : result_chunk_iters)
+            {
+                assign_to_chunk(chunk_iter, policy);
+            }
         }
     }
 
@@ -152,36 +204,105 @@ namespace xt
 
     template <class CT, class F, class X, class O>
     template <class CI>
-    void xblockwise_reducer<CT, F, X, O>::assign_to_chunk(CI& result_chunk_iter) const
+    void xblockwise_reducer<CT, F, X, O>::assign_to_chunk(
+        CI& result_chunk_iter,
+        const execution_policy& policy
+    ) const
     {
         auto result_chunk_view = *result_chunk_iter;
         auto reduction_variable = m_functor.reduction_variable(result_chunk_view);
 
         // get the range of input chunks we need to compute the desired ouput chunk
         auto range = compute_input_chunk_range(result_chunk_iter);
+        std::vector<input_chunk_index_type> input_chunk_indices;
+        for (auto iter = std::get<0>(range); iter != std::get<1>(range); ++iter)
+        {
+            input_chunk_indices.push_back(*iter);
+        }
+        std::size_t nb_input_chunks = input_chunk_indices.size();
+
+        using reduction_variable_type = decltype(reduction_variable);
+        using partial_result_type = xarray<value_type>;
+        constexpr bool mergeable_partials = detail::blockwise::can_merge_partial<
+            functor_type,
+            partial_result_type,
+            reduction_variable_type,
+            decltype(result_chunk_view)>::value;
+
+        if constexpr (mergeable_partials)
+        {
+            if (policy.is_parallel() && nb_input_chunks > 1)
+            {
+                // Every thread merges the blocks of a range of input chunks into a partial result
+                using partial_type = std::pair<partial_result_type, reduction_variable_type>;
+                auto reduce_range = [&](std::size_t first, std::size_t last)
+                {
+                    partial_type partial;
+                    partial.first = partial_result_type::from_shape(result_chunk_view.shape());
+                    partial.second = m_functor.reduction_variable(partial.first);
+                    merge_input_chunks(input_chunk_indices, first, last, partial.first, partial.second);
+                    return partial;
+                };
+                auto merge_partials = [this](partial_type lhs, partial_type&& rhs)
+                {
+                    detail::blockwise::merge_partial(
+                        m_functor,
+                        rhs.first,
+                        rhs.second,
+                        false,
+                        lhs.first,
+                        lhs.second
+                    );
+                    return lhs;
+                };
+                partial_type res = detail::parallel_reduce<partial_type>(
+                    policy,
+                    std::size_t(0),
+                    nb_input_chunks,
+                    reduce_range,
+                    merge_partials
+                );
+                detail::blockwise::merge_partial(
+                    m_functor,
+                    res.first,
+                    res.second,
+                    true,
+                    result_chunk_view,
+                    reduction_variable
+                );
+                m_functor.finalize(reduction_variable, result_chunk_view, *this);
+                return;
+            }
+        }
+
+        merge_input_chunks(input_chunk_indices, 0, nb_input_chunks, result_chunk_view, reduction_variable);
 
-        // iterate over input chunk (indics)
-        auto first = true;
-        // std::for_each(std::get<0>(range), std::get<1>(range), [&](auto && input_chunk_index)
-        auto iter = std::get<0>(range);
-        while (iter != std::get<1>(range))
+        // finalize (ie smth like normalization)
+        m_functor.finalize(reduction_variable, result_chunk_view, *this);
+    }
+
+    template <class CT, class F, class X, class O>
+    template <class I, class E, class MR>
+    void xblockwise_reducer<CT, F, X, O>::merge_input_chunks(
+        const I& input_chunk_indices,
+        std::size_t first,
+        std::size_t last,
+        E& result,
+        MR& mr
+    ) const
+    {
+        for (std::size_t i = first; i < last; ++i)
         {
-            const auto& input_chunk_index = *iter;
             // get input chunk iterator from chunk index
-            auto chunked_input_iter = this->get_input_chunk_iter(input_chunk_index);
+            auto chunked_input_iter = this->get_input_chunk_iter(input_chunk_indices[i]);
             auto input_chunk_view = *chunked_input_iter;
 
             // compute the per block result
             auto block_res = m_functor.compute(input_chunk_view, m_axes, m_options);
 
             // merge
-            m_functor.merge(block_res, first, result_chunk_view, reduction_variable);
-            first = false;
-            ++iter;
+            m_functor.merge(block_res, i == first, result, mr);
         }
-
-        // finalize (ie smth like normalization)
-        m_functor.finalize(reduction_variable, result_chunk_view, *this);
     }
 
     template <class CT, class F, class X, class O>
@@ -371,6 +492,28 @@ namespace xt
 
 #undef XTENSOR_BLOCKWISE_REDUCER_FUNC
 
+        /**
+         * Blockwise version of \ref xt::describe along an axis: the statistics of the
+         * blocks are computed in a single pass and merged.
+         */
+        template <class T = void, class E, class BS, class O = DEFAULT_STRATEGY_REDUCERS>
+        auto describe(E&& e, BS&& block_shape, std::ptrdiff_t axis, O options = O())
+        {
+            using value_type = typename std::decay_t<E>::value_type;
+            using functor_type = xt::detail::blockwise::describe_functor<value_type, T>;
+            std::array<std::size_t, 1> axes = {normalize_axis(e.dimension(), axis)};
+            auto reducer = blockwise_reducer(
+                std::forward<E>(e),
+                std::forward<BS>(block_shape),
+                axes,
+                std::forward<O>(options),
+                functor_type()
+            );
+            auto states = xarray<typename functor_type::value_type>::from_shape(reducer.shape());
+            reducer.assign_to(states);
+            return xt::detail::make_describe_result<value_type, typename functor_type::result_type>(states);
+        }
+
 
 // norm reducers do *not* allow to to pass a template
 // parameter to specifiy the internal computation type
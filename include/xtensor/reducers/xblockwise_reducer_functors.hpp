@@ -45,6 +45,59 @@ namespace xt
                 }
             };
 
+            template <class F, class P, class MR, class E, class = void>
+            struct has_merge_partial : std::false_type
+            {
+            };
+
+            template <class F, class P, class MR, class E>
+            struct has_merge_partial<
+                F,
+                P,
+                MR,
+                E,
+                std::void_t<decltype(std::declval<const F&>().merge_partial(
+                    std::declval<const P&>(),
+                    std::declval<const MR&>(),
+                    true,
+                    std::declval<E&>(),
+                    std::declval<MR&>()
+                ))>> : std::true_type
+            {
+            };
+
+            /**
+             * True if the partial results of the functor \c F over ranges of blocks, made
+             * of a result of type \c P and a reduction variable of type \c MR, can be merged
+             * into a result of type \c E. Functors whose reduction variable is not empty
+             * have to define ``merge_partial(partial, partial_mr, first, result, mr)``.
+             */
+            template <class F, class P, class MR, class E>
+            struct can_merge_partial
+                : std::disjunction<std::is_same<MR, empty_reduction_variable>, has_merge_partial<F, P, MR, E>>
+            {
+            };
+
+            template <class F, class P, class MR, class E>
+            inline void merge_partial(
+                const F& functor,
+                const P& partial,
+                const MR& partial_mr,
+                bool first,
+                E& result,
+                MR& mr
+            )
+            {
+                if constexpr (has_merge_partial<F, P, MR, E>::value)
+                {
+                    functor.merge_partial(partial, partial_mr, first, result, mr);
+                }
+                else
+                {
+                    functor.merge(partial, first, result, mr);
+                }
+            }
+
             template <class T_E, class T_I = void>
             struct sum_functor : public simple_functor_base
             {
@@ -245,12 +298,62 @@ namespace xt
                     }
                 }
 
+                // The partial result of a range of blocks is merged like the result of a block
+                template <class P, class PMR, class E, class MR>
+                void merge_partial(
+                    const P& partial,
+                    const PMR& partial_mr,
+                    bool first,
+                    E& variance_a,
+                    MR& mr
+                ) const
+                {
+                    merge(
+                        std::forward_as_tuple(partial, std::get<0>(partial_mr), std::get<1>(partial_mr)),
+                        first,
+                        variance_a,
+                        mr
+                    );
+                }
+
                 template <class MR, class E, class R>
                 void finalize(const MR&, E&, const R&) const
                 {
                 }
             };
 
+            // Merges the states of the describe statistics of consecutive blocks along
+            // the reduced axis, which are visited in order
+            template <class T_E, class T_I = void>
+            struct describe_functor : public simple_functor_base
+            {
+                using result_type = describe_value_type_t<T_I, T_E>;
+                using value_type = describe_state<T_E, result_type>;
+
+                template <class E, class A, class O>
+                auto compute(const E& input, const A& axes, const O& options) const
+                {
+                    return xt::reduce(describe_functors<T_E, result_type>(), input, axes, options);
+                }
+
+                template <class BR, class E, class MR>
+                auto merge(const BR& block_result, bool first, E& result, MR&) const
+                {
+                    if (first)
+                    {
+                        xt::noalias(result) = block_result;
+                    }
+                    else
+                    {
+                        xt::noalias(result) = make_lambda_xfunction(
+                            describe_merge<T_E, result_type>(),
+                            result,
+                            block_result
+                        );
+                    }
+                }
+            };
+
             template <class T_E, class T_I = void>
             struct stddev_functor : public variance_functor<T_E, T_I>
             {
@@ -11,6 +11,7 @@
 #define XTENSOR_REDUCER_HPP
 
 #include <algorithm>
+#include <array>
 #include <cstddef>
 #include <initializer_list>
 #include <iterator>
@@ -24,11 +25,15 @@
 
 #include "../core/xaccessible.hpp"
 #include "../core/xeval.hpp"
+#include "../core/xexecution.hpp"
 #include "../core/xexpression.hpp"
 #include "../core/xiterable.hpp"
+#include "../core/xoperation.hpp"
+#include "../core/xstrides.hpp"
 #include "../core/xtensor_config.hpp"
 #include "../generators/xbuilder.hpp"
 #include "../generators/xgenerator.hpp"
+#include "../utils/xtensor_simd.hpp"
 #include "../utils/xutils.hpp"
 
 namespace xt
@@ -67,6 +72,56 @@ namespace xt
         return std::make_tuple(xinitial<T>(val));
     }
 
+    /**
+     * Reducer option holding the execution policy of the reduction loops.
+     */
+    struct xpolicy : xt::detail::option_base
+    {
+        constexpr xpolicy(const execution_policy& policy)
+            : m_policy(policy)
+        {
+        }
+
+        constexpr execution_policy value() const
+        {
+            return m_policy;
+        }
+
+        execution_policy m_policy;
+    };
+
+    /**
+     * Returns the reducer option running the reduction with the execution
+     * policy \p policy, e.g. ``xt::sum(a, {0}, xt::with_policy(xt::par))``.
+     * Reductions use ``xt::execution::default_policy`` otherwise.
+     */
+    constexpr auto with_policy(const execution_policy& policy)
+    {
+        return std::make_tuple(xpolicy(policy));
+    }
+
+    struct pairwise_summation_type : xt::detail::option_base
+    {
+    };
+
+    struct kahan_summation_type : xt::detail::option_base
+    {
+    };
+
+    /**
+     * Reducer option summing floating point values with blocked pairwise
+     * summation, e.g. ``xt::sum(a, xt::pairwise)``. The rounding error grows
+     * with the logarithm of the number of summed elements instead of linearly.
+     */
+    constexpr auto pairwise = std::tuple<pairwise_summation_type>{};
+
+    /**
+     * Reducer option summing floating point values with Kahan compensated
+     * summation, e.g. ``xt::mean(a, {0}, xt::kahan)``. The rounding error does
+     * not depend on the number of summed elements.
+     */
+    constexpr auto kahan = std::tuple<kahan_summation_type>{};
+
     template <std::ptrdiff_t I, class T, class Tuple>
     struct tuple_idx_of_impl;
 
@@ -125,7 +180,13 @@ namespace xt
 
         using d_t = std::decay_t<T>;
 
+        template <class X>
+        struct policy_tester : std::is_same<std::decay_t<X>, xpolicy>
+        {
+        };
+
         static constexpr std::size_t initial_val_idx = xtl::mpl::find_if<initial_tester, d_t>::value;
+        static constexpr std::size_t policy_idx = xtl::mpl::find_if<policy_tester, d_t>::value;
         reducer_options() = default;
 
         reducer_options(const T& tpl)
@@ -135,6 +196,10 @@ namespace xt
                 initial_value = std::get < initial_val_idx != std::tuple_size<T>::value ? initial_val_idx
                                                                                         : 0 > (tpl).value();
             }
+            if constexpr (policy_idx != std::tuple_size<T>::value)
+            {
+                policy = std::get<policy_idx>(tpl).value();
+            }
         }
 
         using evaluation_strategy = std::conditional_t<
@@ -145,9 +210,19 @@ namespace xt
         using keep_dims = std::
             conditional_t<tuple_idx_of<xt::keep_dims_type, d_t>::value != -1, std::true_type, std::false_type>;
 
+        // void when sums are accumulated naively
+        using summation_type = std::conditional_t<
+            tuple_idx_of<pairwise_summation_type, d_t>::value != -1,
+            pairwise_summation_type,
+            std::conditional_t<
+                tuple_idx_of<kahan_summation_type, d_t>::value != -1,
+                kahan_summation_type,
+                void>>;
+
         static constexpr bool has_initial_value = initial_val_idx != std::tuple_size<d_t>::value;
 
         R initial_value;
+        execution_policy policy = execution::default_policy;
 
         template <class NR>
         using rebind_t = reducer_options<NR, T>;
@@ -157,6 +232,7 @@ namespace xt
         {
             reducer_options<NR, T> res;
             res.initial_value = initial;
+            res.policy = policy;
             return res;
         }
     };
@@ -287,6 +363,381 @@ namespace xt
         }
     }
 
+    /**
+     * Traits class specifying whether the reducing functor \c F is associative
+     * and commutative. The elements reduced with such a functor can be split
+     * over several independent accumulators (or SIMD lanes) merged afterwards
+     * with \c F, which removes the dependency between consecutive reductions.
+     * Specialize it to enable this for custom functors.
+     */
+    template <class F>
+    struct is_associative_reducer : std::false_type
+    {
+    };
+
+    template <>
+    struct is_associative_reducer<detail::plus> : std::true_type
+    {
+    };
+
+    template <>
+    struct is_associative_reducer<detail::multiplies> : std::true_type
+    {
+    };
+
+    template <>
+    struct is_associative_reducer<detail::logical_or> : std::true_type
+    {
+    };
+
+    template <>
+    struct is_associative_reducer<detail::logical_and> : std::true_type
+    {
+    };
+
+    namespace detail
+    {
+        /**
+         * Reducing functors of commutative reductions can define a
+         * ``reduce_range(init, first, last)`` method, which reduces the elements of
+         * an iterator range at once (e.g. by blocks). It is used instead of the
+         * element-wise reduction for contiguous elements of immediate reductions and
+         * for complete reductions.
+         */
+        template <class F, class R, class It, class = void>
+        struct has_reduce_range : std::false_type
+        {
+        };
+
+        template <class F, class R, class It>
+        struct has_reduce_range<
+            F,
+            R,
+            It,
+            std::void_t<decltype(std::declval<const F&>().reduce_range(
+                std::declval<R>(),
+                std::declval<It>(),
+                std::declval<It>()
+            ))>>
+            : std::true_type
+        {
+        };
+
+        template <class F, class T>
+        using simd_reduce_result_t = decltype(std::declval<const F&>().simd_apply(
+            std::declval<const xt_simd::simd_type<T>&>(),
+            std::declval<const xt_simd::simd_type<T>&>()
+        ));
+
+        template <class F, class T, class = void>
+        struct has_simd_reduce : std::false_type
+        {
+        };
+
+        template <class F, class T>
+        struct has_simd_reduce<F, T, std::void_t<simd_reduce_result_t<F, T>>>
+            : std::conjunction<
+                  has_simd_type<T>,
+                  std::negation<std::is_same<T, bool>>,
+                  std::is_same<simd_reduce_result_t<F, T>, xt_simd::simd_type<T>>>
+        {
+        };
+
+        // Returns true if the elements of e can be visited in the order of their
+        // index with linear_begin and load_simd, as in a linear assignment.
+        template <class E>
+        inline bool is_linear_reducible(const E& e)
+        {
+            layout_type l = e.layout();
+            if (l != layout_type::row_major && l != layout_type::column_major)
+            {
+                l = XTENSOR_DEFAULT_LAYOUT;
+            }
+            dynamic_shape<std::ptrdiff_t> strides(e.dimension());
+            compute_strides(e.shape(), l, strides);
+            return e.has_linear_assign(strides);
+        }
+
+        /**
+         * Reduces the elements [first, last) of the linear traversal of \c e with
+         * the associative reducer \c f, starting from \c init. The elements are
+         * spread over several independent accumulators, batches when \c f can be
+         * applied on SIMD registers, which are merged at the end.
+         */
+        template <class F, class E, class R>
+        inline R linear_reduce(const F& f, const E& e, std::size_t first, std::size_t last, R init)
+        {
+            using value_type = typename E::value_type;
+            constexpr std::size_t nb_acc = 4;
+
+            if constexpr (std::is_same<R, value_type>::value && has_simd_reduce<F, value_type>::value
+                          && has_simd_interface<E, value_type>::value)
+            {
+                using batch_type = xt_simd::simd_type<value_type>;
+                constexpr std::size_t simd_size = xt_simd::simd_traits<value_type>::size;
+                constexpr std::size_t unroll_size = nb_acc * simd_size;
+                auto load = [&e](std::size_t i)
+                {
+                    return e.template load_simd<xt_simd::unaligned_mode, value_type>(i);
+                };
+
+                if (last - first >= unroll_size)
+                {
+                    std::array<batch_type, nb_acc> acc;
+                    for (std::size_t k = 0; k < nb_acc; ++k)
+                    {
+                        acc[k] = load(first + k * simd_size);
+                    }
+                    first += unroll_size;
+                    for (; first + unroll_size <= last; first += unroll_size)
+                    {
+                        for (std::size_t k = 0; k < nb_acc; ++k)
+                        {
+                            acc[k] = f.simd_apply(acc[k], load(first + k * simd_size));
+                        }
+                    }
+                    for (; first + simd_size <= last; first += simd_size)
+                    {
+                        acc[0] = f.simd_apply(acc[0], load(first));
+                    }
+                    batch_type res = f.simd_apply(f.simd_apply(acc[0], acc[1]), f.simd_apply(acc[2], acc[3]));
+
+                    std::array<value_type, simd_size> lanes;
+                    xt_simd::store_as(lanes.data(), res, xt_simd::unaligned_mode());
+                    for (const auto& v : lanes)
+                    {
+                        init = f(init, v);
+                    }
+                }
+            }
+
+            auto it = linear_begin(e) + static_cast<std::ptrdiff_t>(first);
+            if constexpr (std::is_arithmetic<R>::value)
+            {
+                if (last - first >= 2 * nb_acc)
+                {
+                    std::array<R, nb_acc> acc;
+                    for (auto& a : acc)
+                    {
+                        a = static_cast<R>(*it);
+                        ++it;
+                    }
+                    first += nb_acc;
+                    for (; first + nb_acc <= last; first += nb_acc)
+                    {
+                        for (auto& a : acc)
+                        {
+                            a = static_cast<R>(f(a, *it));
+                            ++it;
+                        }
+                    }
+                    init = static_cast<R>(f(init, f(f(acc[0], acc[1]), f(acc[2], acc[3]))));
+                }
+            }
+            for (; first != last; ++first, ++it)
+            {
+                init = static_cast<R>(f(init, *it));
+            }
+            return init;
+        }
+
+        /**
+         * True if the reducer whose reduce and merge functors are \c RF and \c MF
+         * sums values of type \c R with the summation strategy of the options \c O.
+         */
+        template <class RF, class MF, class R, class O>
+        struct is_compensated_sum
+            : std::conjunction<
+                  std::negation<std::is_void<typename O::summation_type>>,
+                  std::is_same<RF, plus>,
+                  std::is_same<MF, plus>,
+                  std::is_floating_point<R>>
+        {
+        };
+
+        // Adds v to sum, comp holding the opposite of the rounding errors of sum
+        template <class T>
+        inline void kahan_add(T& sum, T& comp, const T& v)
+        {
+            T y = v - comp;
+            T t = sum + y;
+            comp = (t - sum) - y;
+            sum = t;
+        }
+
+        // Kahan compensated sum of scalars or batches
+        template <class T>
+        struct kahan_accumulator
+        {
+            explicit kahan_accumulator(const T& init = T(0))
+                : m_sum(init)
+                , m_comp(T(0))
+            {
+            }
+
+            void add(const T& v)
+            {
+                kahan_add(m_sum, m_comp, v);
+            }
+
+            void merge(const kahan_accumulator& rhs)
+            {
+                add(rhs.m_sum);
+                add(-rhs.m_comp);
+            }
+
+            T value() const
+            {
+                return m_sum - m_comp;
+            }
+
+            T m_sum;
+            T m_comp;
+        };
+
+        // Sums partial sums of consecutive blocks of equal sizes as the leaves of a
+        // binary tree, keeping at most one pending partial sum per level
+        template <class T>
+        class pairwise_accumulator
+        {
+        public:
+
+            void add(T v)
+            {
+                std::size_t level = 0;
+                for (std::size_t n = m_count; n & 1; n >>= 1, ++level)
+                {
+                    v = m_partials[level] + v;
+                }
+                m_partials[level] = v;
+                ++m_count;
+            }
+
+            // Precondition: at least one partial sum has been added
+            T value() const
+            {
+                std::size_t level = 0;
+                std::size_t n = m_count;
+                for (; (n & 1) == 0; n >>= 1, ++level)
+                {
+                }
+                T res = m_partials[level];
+                for (n >>= 1, ++level; n != 0; n >>= 1, ++level)
+                {
+                    if (n & 1)
+                    {
+                        res = res + m_partials[level];
+                    }
+                }
+                return res;
+            }
+
+        private:
+
+            std::array<T, 64> m_partials;
+            std::size_t m_count = 0;
+        };
+
+        // Sums load(first + i) over the largest multiple of nb_acc * width elements of [first, last),
+        // which must contain at least one, where load returns width elements packed in a T.
+        template <class S, class T, std::size_t width, class L>
+        inline T compensated_sum_impl(const L& load, std::size_t& first, std::size_t last)
+        {
+            constexpr std::size_t nb_acc = 4;
+            constexpr std::size_t step = nb_acc * width;
+            if constexpr (std::is_same<S, pairwise_summation_type>::value)
+            {
+                // Number of steps summed naively in the leaves of the tree
+                constexpr std::size_t block_size = 16 * step;
+                pairwise_accumulator<T> res;
+                std::array<T, nb_acc> acc;
+                while (first + step <= last)
+                {
+                    std::size_t block_last = first + std::min(block_size, (last - first) / step * step);
+                    for (std::size_t k = 0; k < nb_acc; ++k)
+                    {
+                        acc[k] = load(first + k * width);
+                    }
+                    for (first += step; first != block_last; first += step)
+                    {
+                        for (std::size_t k = 0; k < nb_acc; ++k)
+                        {
+                            acc[k] = acc[k] + load(first + k * width);
+                        }
+                    }
+                    res.add((acc[0] + acc[1]) + (acc[2] + acc[3]));
+                }
+                return res.value();
+            }
+            else
+            {
+                std::array<kahan_accumulator<T>, nb_acc> acc;
+                for (; first + step <= last; first += step)
+                {
+                    for (std::size_t k = 0; k < nb_acc; ++k)
+                    {
+                        acc[k].add(load(first + k * width));
+                    }
+                }
+                acc[0].merge(acc[1]);
+                acc[2].merge(acc[3]);
+                acc[0].merge(acc[2]);
+                return acc[0].value();
+            }
+        }
+
+        /**
+         * Sums the elements [first, last) of the linear traversal of \c e, starting
+         * from \c init, with the summation strategy \c S. The elements are spread
+         * over several independent accumulators, batches when \c e has a SIMD
+         * interface, whose results are added with Kahan summation.
+         */
+        template <class S, class E, class R>
+        inline R compensated_sum(const E& e, std::size_t first, std::size_t last, R init)
+        {
+            using value_type = typename E::value_type;
+            constexpr std::size_t nb_acc = 4;
+            kahan_accumulator<R> res(init);
+
+            if constexpr (std::is_same<R, value_type>::value && has_simd_type<value_type>::value
+                          && has_simd_interface<E, value_type>::value)
+            {
+                using batch_type = xt_simd::simd_type<value_type>;
+                constexpr std::size_t simd_size = xt_simd::simd_traits<value_type>::size;
+                if (last - first >= nb_acc * simd_size)
+                {
+                    auto load = [&e](std::size_t i)
+                    {
+                        return e.template load_simd<xt_simd::unaligned_mode, value_type>(i);
+                    };
+                    batch_type sum = compensated_sum_impl<S, batch_type, simd_size>(load, first, last);
+
+                    std::array<value_type, simd_size> lanes;
+                    xt_simd::store_as(lanes.data(), sum, xt_simd::unaligned_mode());
+                    for (const auto& v : lanes)
+                    {
+                        res.add(v);
+                    }
+                }
+            }
+
+            auto begin = linear_begin(e);
+            auto load = [&begin](std::size_t i)
+            {
+                return static_cast<R>(*(begin + static_cast<std::ptrdiff_t>(i)));
+            };
+            if (last - first >= nb_acc)
+            {
+                res.add(compensated_sum_impl<S, R, 1>(load, first, last));
+            }
+            for (; first != last; ++first)
+            {
+                res.add(load(first));
+            }
+            return res.value();
+        }
+    }
+
     template <class F, class E, class X, class O>
     inline auto reduce_immediate(F&& f, E&& e, X&& axes, O&& raw_options)
     {
@@ -301,6 +752,10 @@ namespace xt
         using options_t = reducer_options<result_type, std::decay_t<O>>;
         options_t options(raw_options);
 
+        using merge_functor_type = typename std::decay_t<F>::merge_functor_type;
+        constexpr bool compensated = detail::
+            is_compensated_sum<reduce_functor_type, merge_functor_type, result_type, options_t>::value;
+
         using shape_type = typename xreducer_shape_type<
             typename std::decay_t<E>::shape_type,
             std::decay_t<X>,
@@ -352,11 +807,72 @@ namespace xt
 
         detail::shape_computation<options_t>(result_shape, result, e, axes);
 
+        // Reduces the elements [first, last) of the storage of e, starting from init
+        auto accumulate = [&e, &reduce_fct](std::size_t first, std::size_t last, result_type init)
+            -> result_type
+        {
+            if constexpr (compensated)
+            {
+                return detail::compensated_sum<typename options_t::summation_type>(e, first, last, init);
+            }
+            else if constexpr (is_associative_reducer<reduce_functor_type>::value)
+            {
+                return detail::linear_reduce(reduce_fct, e, first, last, init);
+            }
+            else
+            {
+                auto begin = e.storage().begin();
+                using iterator = decltype(begin);
+                if constexpr (detail::has_reduce_range<reduce_functor_type, result_type, iterator>::value)
+                {
+                    return reduce_fct.reduce_range(
+                        init,
+                        begin + static_cast<std::ptrdiff_t>(first),
+                        begin + static_cast<std::ptrdiff_t>(last)
+                    );
+                }
+                else
+                {
+                    return std::accumulate(
+                        begin + static_cast<std::ptrdiff_t>(first),
+                        begin + static_cast<std::ptrdiff_t>(last),
+                        init,
+                        reduce_fct
+                    );
+                }
+            }
+        };
+
+        // Reducing an element costs about a load and an operation
+        constexpr std::size_t reduce_cost = 2;
+        const execution_policy& policy = options.policy;
+
         // Fast track for complete reduction
         if (e.dimension() == axes.size())
         {
             result_type tmp = options_t::has_initial_value ? options.initial_value : init_fct();
-            result.data()[0] = std::accumulate(e.storage().begin(), e.storage().end(), tmp, reduce_fct);
+            if (policy.use_parallel(e.size(), reduce_cost))
+            {
+                result.data()[0] = detail::parallel_reduce<result_type>(
+                    policy,
+                    std::size_t(0),
+                    e.size(),
+                    [&](std::size_t first, std::size_t last)
+                    {
+                        result_type init = first == 0 ? tmp : static_cast<result_type>(init_fct());
+                        return accumulate(first, last, init);
+                    },
+                    [&merge_fct](const result_type& lhs, const result_type& rhs)
+                    {
+                        return static_cast<result_type>(merge_fct(lhs, rhs));
+                    },
+                    policy.grain_size(reduce_cost)
+                );
+            }
+            else
+            {
+                result.data()[0] = accumulate(0, e.size(), tmp);
+            }
             return result;
         }
 
@@ -438,117 +954,281 @@ namespace xt
             XTENSOR_THROW(std::runtime_error, "Layout not supported in immediate reduction.");
         }
 
-        xindex temp_idx(iter_shape.size());
-        auto next_idx = [&iter_shape, &iter_strides, &temp_idx]()
+        // Every iteration over iter_shape visits the next block_size elements of e
+        std::size_t block_size = outer_loop_size * inner_stride;
+        auto data = e.data();
+
+        // Runs the iterations over shape, whose first element is at offset first in e, reducing
+        // the range [outer_first, outer_last) of their outer loop into the outputs at out_begin.
+        auto reduce_loops = [&](std::size_t first,
+                                auto out_begin,
+                                const dynamic_shape<std::size_t>& shape,
+                                std::size_t outer_first,
+                                std::size_t outer_last)
         {
-            std::size_t i = iter_shape.size();
-            for (; i > 0; --i)
+            xindex temp_idx(shape.size());
+            auto next_idx = [&shape, &iter_strides, &temp_idx]()
             {
-                if (std::ptrdiff_t(temp_idx[i - 1]) >= std::ptrdiff_t(iter_shape[i - 1]) - 1)
-                {
-                    temp_idx[i - 1] = 0;
-                }
-                else
+                std::size_t i = shape.size();
+                for (; i > 0; --i)
                 {
-                    temp_idx[i - 1]++;
-                    break;
+                    if (std::ptrdiff_t(temp_idx[i - 1]) >= std::ptrdiff_t(shape[i - 1]) - 1)
+                    {
+                        temp_idx[i - 1] = 0;
+                    }
+                    else
+                    {
+                        temp_idx[i - 1]++;
+                        break;
+                    }
                 }
-            }
 
-            return std::make_pair(
-                i == 0,
-                std::inner_product(temp_idx.begin(), temp_idx.end(), iter_strides.begin(), std::ptrdiff_t(0))
-            );
-        };
+                return std::make_pair(
+                    i == 0,
+                    std::inner_product(
+                        temp_idx.begin(),
+                        temp_idx.end(),
+                        iter_strides.begin(),
+                        std::ptrdiff_t(0)
+                    )
+                );
+            };
 
-        auto begin = e.data();
-        auto out = result.data();
-        auto out_begin = result.data();
+            std::size_t begin = first;
+            auto out = out_begin;
 
-        std::ptrdiff_t next_stride = 0;
+            std::ptrdiff_t next_stride = 0;
 
-        std::pair<bool, std::ptrdiff_t> idx_res(false, 0);
+            std::pair<bool, std::ptrdiff_t> idx_res(false, 0);
 
-        // Remark: eventually some modifications here to make conditions faster where merge + accumulate is
-        // the same function (e.g. check std::is_same<decltype(merge_fct), decltype(reduce_fct)>::value) ...
+            // Remark: eventually some modifications here to make conditions faster where merge +
+            // accumulate is the same function (e.g. check
+            // std::is_same<decltype(merge_fct), decltype(reduce_fct)>::value)
 
-        auto merge_border = out;
-        bool merge = false;
+            auto merge_border = out;
+            bool merge = false;
 
-        // TODO there could be some performance gain by removing merge checking
-        //      when axes.size() == 1 and even next_idx could be removed for something simpler (next_stride
-        //      always the same) best way to do this would be to create a function that takes (begin, out,
-        //      outer_loop_size, inner_loop_size, next_idx_lambda)
-        // Decide if going about it row-wise or col-wise
-        if (inner_stride == 1)
-        {
-            while (idx_res.first != true)
+            // Compensations of the outputs of compensated sums, which are indexed like out_begin
+            std::vector<result_type> comp;
+            if constexpr (compensated)
             {
-                // for unknown reasons it's much faster to use a temporary variable and
-                // std::accumulate here -- probably some cache behavior
-                result_type tmp = init_fct();
-                tmp = std::accumulate(begin, begin + outer_loop_size, tmp, reduce_fct);
+                std::size_t extent = inner_stride == 1 ? 1 : inner_loop_size;
+                for (std::size_t i = 0; i < shape.size(); ++i)
+                {
+                    extent += shape[i] != 0 ? (shape[i] - 1) * iter_strides[i] : 0;
+                }
+                comp.resize(extent, result_type(0));
+            }
 
-                // use merge function if necessary
-                *out = merge ? merge_fct(*out, tmp) : tmp;
+            // TODO there could be some performance gain by removing merge checking
+            //      when axes.size() == 1 and even next_idx could be removed for something simpler
+            //      (next_stride always the same) best way to do this would be to create a function that
+            //      takes (begin, out, outer_loop_size, inner_loop_size, next_idx_lambda)
+            // Decide if going about it row-wise or col-wise
+            if (inner_stride == 1)
+            {
+                while (idx_res.first != true)
+                {
+                    // for unknown reasons it's much faster to use a temporary variable and
+                    // std::accumulate here -- probably some cache behavior
+                    result_type tmp = init_fct();
+                    tmp = accumulate(begin + outer_first, begin + outer_last, tmp);
 
-                begin += outer_loop_size;
+                    // use merge function if necessary
+                    if constexpr (compensated)
+                    {
+                        if (merge)
+                        {
+                            detail::kahan_add(*out, comp[static_cast<std::size_t>(out - out_begin)], tmp);
+                        }
+                        else
+                        {
+                            *out = tmp;
+                        }
+                    }
+                    else
+                    {
+                        *out = merge ? merge_fct(*out, tmp) : tmp;
+                    }
 
-                idx_res = next_idx();
-                next_stride = idx_res.second;
-                out = out_begin + next_stride;
+                    begin += block_size;
 
-                if (out > merge_border)
-                {
-                    // looped over once
-                    merge = false;
-                    merge_border = out;
-                }
-                else
-                {
-                    merge = true;
-                }
-            };
-        }
-        else
-        {
-            while (idx_res.first != true)
+                    idx_res = next_idx();
+                    next_stride = idx_res.second;
+                    out = out_begin + next_stride;
+
+                    if (out > merge_border)
+                    {
+                        // looped over once
+                        merge = false;
+                        merge_border = out;
+                    }
+                    else
+                    {
+                        merge = true;
+                    }
+                };
+            }
+            else
             {
-                std::transform(
-                    out,
-                    out + inner_loop_size,
-                    begin,
-                    out,
-                    [merge, &init_fct, &reduce_fct](auto&& v1, auto&& v2)
+                while (idx_res.first != true)
+                {
+                    auto row = data + begin + outer_first * inner_stride;
+                    if constexpr (compensated)
                     {
-                        return merge ? reduce_fct(v1, v2) :
-                                     // cast because return type of identity function is not upcasted
-                                   reduce_fct(static_cast<result_type>(init_fct()), v2);
+                        auto out_comp = comp.begin() + (out - out_begin);
+                        std::size_t i = outer_first;
+                        if (!merge)
+                        {
+                            std::transform(
+                                row,
+                                row + inner_loop_size,
+                                out,
+                                [&init_fct, &reduce_fct](auto&& v)
+                                {
+                                    return reduce_fct(static_cast<result_type>(init_fct()), v);
+                                }
+                            );
+                            ++i;
+                            row += inner_stride;
+                        }
+                        for (; i < outer_last; ++i, row += inner_stride)
+                        {
+                            for (std::size_t j = 0; j < inner_loop_size; ++j)
+                            {
+                                detail::kahan_add(out[j], out_comp[j], static_cast<result_type>(row[j]));
+                            }
+                        }
                     }
-                );
+                    else
+                    {
+                        std::transform(
+                            out,
+                            out + inner_loop_size,
+                            row,
+                            out,
+                            [merge, &init_fct, &reduce_fct](auto&& v1, auto&& v2)
+                            {
+                                return merge ? reduce_fct(v1, v2) :
+                                             // cast because return type of identity function is not upcasted
+                                           reduce_fct(static_cast<result_type>(init_fct()), v2);
+                            }
+                        );
+
+                        for (std::size_t i = outer_first + 1; i < outer_last; ++i)
+                        {
+                            row += inner_stride;
+                            std::transform(out, out + inner_loop_size, row, out, reduce_fct);
+                        }
+                    }
+                    begin += block_size;
 
-                begin += inner_stride;
-                for (std::size_t i = 1; i < outer_loop_size; ++i)
-                {
-                    std::transform(out, out + inner_loop_size, begin, out, reduce_fct);
-                    begin += inner_stride;
-                }
+                    idx_res = next_idx();
+                    next_stride = idx_res.second;
+                    out = out_begin + next_stride;
 
-                idx_res = next_idx();
-                next_stride = idx_res.second;
-                out = out_begin + next_stride;
+                    if (out > merge_border)
+                    {
+                        // looped over once
+                        merge = false;
+                        merge_border = out;
+                    }
+                    else
+                    {
+                        merge = true;
+                    }
+                };
+            }
 
-                if (out > merge_border)
-                {
-                    // looped over once
-                    merge = false;
-                    merge_border = out;
-                }
-                else
+            if constexpr (compensated)
+            {
+                // Only the outputs of this call have a compensation
+                for (std::size_t i = 0; i < comp.size(); ++i)
                 {
-                    merge = true;
+                    if (comp[i] != result_type(0))
+                    {
+                        out_begin[i] -= comp[i];
+                    }
                 }
+            }
+        };
+
+        // Partial results of the reductions split over a reduced axis
+        auto merge_results = [&merge_fct](result_container_type lhs, result_container_type&& rhs)
+        {
+            std::transform(lhs.data(), lhs.data() + lhs.size(), rhs.data(), lhs.data(), merge_fct);
+            return lhs;
+        };
+
+        if (!policy.use_parallel(e.size(), reduce_cost))
+        {
+            reduce_loops(0, result.data(), iter_shape, 0, outer_loop_size);
+        }
+        else if (!iter_shape.empty() && iter_shape[0] > 1)
+        {
+            // Splits the outermost iteration axis in slices
+            std::size_t split_size = iter_shape[0];
+            std::size_t slice_size = std::accumulate(
+                                         iter_shape.begin() + 1,
+                                         iter_shape.end(),
+                                         block_size,
+                                         std::multiplies<std::size_t>()
+                                     );
+            auto reduce_slices = [&](std::size_t first, std::size_t last, auto out_begin)
+            {
+                dynamic_shape<std::size_t> shape = iter_shape;
+                shape[0] = last - first;
+                reduce_loops(first * slice_size, out_begin, shape, 0, outer_loop_size);
             };
+            std::size_t grain = policy.grain_size(reduce_cost * slice_size);
+            if (iter_strides[0] != 0)
+            {
+                // Slices of a kept axis write to different outputs
+                detail::parallel_for(
+                    policy,
+                    std::size_t(0),
+                    split_size,
+                    [&](std::size_t first, std::size_t last)
+                    {
+                        reduce_slices(first, last, result.data() + first * iter_strides[0]);
+                    },
+                    grain
+                );
+            }
+            else
+            {
+                result = detail::parallel_reduce<result_container_type>(
+                    policy,
+                    std::size_t(0),
+                    split_size,
+                    [&](std::size_t first, std::size_t last)
+                    {
+                        result_container_type partial = result;
+                        reduce_slices(first, last, partial.data());
+                        return partial;
+                    },
+                    merge_results,
+                    grain
+                );
+            }
+        }
+        else
+        {
+            // Splits the outer loop, which runs over reduced axes
+            std::size_t nb_iterations = e.size() / std::max(outer_loop_size, std::size_t(1));
+            result = detail::parallel_reduce<result_container_type>(
+                policy,
+                std::size_t(0),
+                outer_loop_size,
+                [&](std::size_t first, std::size_t last)
+                {
+                    result_container_type partial = result;
+                    reduce_loops(0, partial.data(), iter_shape, first, last);
+                    return partial;
+                },
+                merge_results,
+                policy.grain_size(reduce_cost * nb_iterations)
+            );
         }
         if (options_t::has_initial_value)
         {
@@ -1101,6 +1781,12 @@ namespace xt
         using substepper_type = typename xexpression_type::const_stepper;
         using shape_type = typename xreducer_type::shape_type;
 
+        static constexpr bool compensated = detail::is_compensated_sum<
+            typename xreducer_type::reduce_functor_type,
+            typename xreducer_type::merge_functor_type,
+            value_type,
+            O>::value;
+
         xreducer_stepper(
             const xreducer_type& red,
             size_type offset,
@@ -1124,8 +1810,11 @@ namespace xt
 
         reference initial_value() const;
         reference aggregate(size_type dim) const;
+        bool aggregate_linear(size_type dim, reference& res) const;
         reference aggregate_impl(size_type dim, /*keep_dims=*/std::false_type) const;
         reference aggregate_impl(size_type dim, /*keep_dims=*/std::true_type) const;
+        reference reduce_axis(size_type index, size_type size) const;
+        reference merge_axis(size_type index, size_type size, size_type dim) const;
 
         substepper_type get_substepper_begin() const;
         size_type get_dim(size_type dim) const noexcept;
@@ -1659,6 +2348,17 @@ namespace xt
         );
     }
 
+    /**
+     * Returns the estimated cost of computing one element of the reducer \p e,
+     * which reduces several elements of its underlying expression.
+     */
+    template <class F, class CT, class X, class O>
+    inline std::size_t element_cost(const xreducer<F, CT, X, O>& e) noexcept
+    {
+        std::size_t nb_reduced = e.expression().size() / std::max(e.size(), std::size_t(1));
+        return detail::saturated_product(nb_reduced, expression_cost<std::decay_t<CT>>::value + 1);
+    }
+
     /***********************************
      * xreducer_stepper implementation *
      ***********************************/
@@ -1789,7 +2489,10 @@ namespace xt
         }
         else
         {
-            res = aggregate_impl(dim, typename O::keep_dims());
+            if (!aggregate_linear(dim, res))
+            {
+                res = aggregate_impl(dim, typename O::keep_dims());
+            }
             if (O::has_initial_value && dim == 0)
             {
                 res = m_reducer->m_merge(m_reducer->m_options.initial_value, res);
@@ -1798,6 +2501,69 @@ namespace xt
         return res;
     }
 
+    template <class F, class CT, class X, class O>
+    inline bool xreducer_stepper<F, CT, X, O>::aggregate_linear(size_type dim, reference& res) const
+    {
+        using reduce_functor_type = typename xreducer_type::reduce_functor_type;
+        using linear_iterator = decltype(linear_begin(m_reducer->m_e));
+        constexpr bool range_reducible = detail::
+            has_reduce_range<reduce_functor_type, reference, linear_iterator>::value;
+        if constexpr (is_associative_reducer<reduce_functor_type>::value || range_reducible)
+        {
+            // The order of the elements does not matter in a complete reduction
+            if (dim == 0 && m_reducer->m_axes.size() == m_reducer->m_e.dimension()
+                && detail::is_linear_reducible(m_reducer->m_e))
+            {
+                auto reduce_range = [this](std::size_t first, std::size_t last)
+                {
+                    auto init = static_cast<reference>(m_reducer->m_init());
+                    if constexpr (compensated)
+                    {
+                        using summation_type = typename O::summation_type;
+                        return detail::compensated_sum<summation_type>(m_reducer->m_e, first, last, init);
+                    }
+                    else if constexpr (range_reducible)
+                    {
+                        auto begin = linear_begin(m_reducer->m_e);
+                        return m_reducer->m_reduce.reduce_range(
+                            init,
+                            begin + static_cast<std::ptrdiff_t>(first),
+                            begin + static_cast<std::ptrdiff_t>(last)
+                        );
+                    }
+                    else
+                    {
+                        return detail::linear_reduce(m_reducer->m_reduce, m_reducer->m_e, first, last, init);
+                    }
+                };
+
+                const execution_policy& policy = m_reducer->m_options.policy;
+                constexpr std::size_t cost = expression_cost<xexpression_type>::value + 1;
+                std::size_t size = m_reducer->m_e.size();
+                if (policy.use_parallel(size, cost))
+                {
+                    res = detail::parallel_reduce<reference>(
+                        policy,
+                        std::size_t(0),
+                        size,
+                        reduce_range,
+                        [this](const reference& lhs, const reference& rhs)
+                        {
+                            return static_cast<reference>(m_reducer->m_merge(lhs, rhs));
+                        },
+                        policy.grain_size(cost)
+                    );
+                }
+                else
+                {
+                    res = reduce_range(0, size);
+                }
+                return true;
+            }
+        }
+        return false;
+    }
+
     template <class F, class CT, class X, class O>
     inline auto xreducer_stepper<F, CT, X, O>::aggregate_impl(size_type dim, std::false_type) const -> reference
     {
@@ -1807,21 +2573,11 @@ namespace xt
         size_type size = shape(index);
         if (dim != m_reducer->m_axes.size() - 1)
         {
-            res = aggregate_impl(dim + 1, typename O::keep_dims());
-            for (size_type i = 1; i != size; ++i)
-            {
-                m_stepper.step(index);
-                res = m_reducer->m_merge(res, aggregate_impl(dim + 1, typename O::keep_dims()));
-            }
+            res = merge_axis(index, size, dim);
         }
         else
         {
-            res = m_reducer->m_reduce(static_cast<reference>(m_reducer->m_init()), *m_stepper);
-            for (size_type i = 1; i != size; ++i)
-            {
-                m_stepper.step(index);
-                res = m_reducer->m_reduce(res, *m_stepper);
-            }
+            res = reduce_axis(index, size);
         }
         m_stepper.reset(index);
         return res;
@@ -1839,21 +2595,11 @@ namespace xt
             size_type size = m_reducer->m_e.shape()[index];
             if (ax_it != m_reducer->m_axes.end() - 1 && size != 0)
             {
-                res = aggregate_impl(dim + 1, typename O::keep_dims());
-                for (size_type i = 1; i != size; ++i)
-                {
-                    m_stepper.step(index);
-                    res = m_reducer->m_merge(res, aggregate_impl(dim + 1, typename O::keep_dims()));
-                }
+                res = merge_axis(index, size, dim);
             }
             else
             {
-                res = m_reducer->m_reduce(static_cast<reference>(m_reducer->m_init()), *m_stepper);
-                for (size_type i = 1; i != size; ++i)
-                {
-                    m_stepper.step(index);
-                    res = m_reducer->m_reduce(res, *m_stepper);
-                }
+                res = reduce_axis(index, size);
             }
             m_stepper.reset(index);
         }
@@ -1867,6 +2613,61 @@ namespace xt
         return res;
     }
 
+    template <class F, class CT, class X, class O>
+    inline auto xreducer_stepper<F, CT, X, O>::reduce_axis(size_type index, size_type size) const -> reference
+    {
+        if constexpr (compensated)
+        {
+            detail::kahan_accumulator<reference> res(static_cast<reference>(m_reducer->m_init()));
+            res.add(static_cast<reference>(*m_stepper));
+            for (size_type i = 1; i != size; ++i)
+            {
+                m_stepper.step(index);
+                res.add(static_cast<reference>(*m_stepper));
+            }
+            return res.value();
+        }
+        else
+        {
+            reference res = m_reducer->m_reduce(static_cast<reference>(m_reducer->m_init()), *m_stepper);
+            for (size_type i = 1; i != size; ++i)
+            {
+                m_stepper.step(index);
+                res = m_reducer->m_reduce(res, *m_stepper);
+            }
+            return res;
+        }
+    }
+
+    template <class F, class CT, class X, class O>
+    inline auto xreducer_stepper<F, CT, X, O>::merge_axis(
+        size_type index,
+        size_type size,
+        size_type dim
+    ) const -> reference
+    {
+        if constexpr (compensated)
+        {
+            detail::kahan_accumulator<reference> res(aggregate_impl(dim + 1, typename O::keep_dims()));
+            for (size_type i = 1; i != size; ++i)
+            {
+                m_stepper.step(index);
+                res.add(aggregate_impl(dim + 1, typename O::keep_dims()));
+            }
+            return res.value();
+        }
+        else
+        {
+            reference res = aggregate_impl(dim + 1, typename O::keep_dims());
+            for (size_type i = 1; i != size; ++i)
+            {
+                m_stepper.step(index);
+                res = m_reducer->m_merge(res, aggregate_impl(dim + 1, typename O::keep_dims()));
+            }
+            return res;
+        }
+    }
+
     template <class F, class CT, class X, class O>
     inline auto xreducer_stepper<F, CT, X, O>::get_substepper_begin() const -> substepper_type
     {
@@ -10,6 +10,9 @@
 #ifndef XTENSOR_SIMD_HPP
 #define XTENSOR_SIMD_HPP
 
+#include <cstring>
+#include <limits>
+#include <type_traits>
 #include <vector>
 
 #include <xtl/xdynamic_bitset.hpp>
@@ -204,6 +207,257 @@ namespace xt_simd
 
 #endif  // XTENSOR_USE_XSIMD
 
+/********************
+ * streaming stores *
+ ********************/
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <immintrin.h>
+#define XTENSOR_SSE2_STREAM_STORE
+#endif
+
+namespace xt_simd
+{
+    /**
+     * Non-temporal stores write full cache lines to memory without reading them
+     * first and without evicting the cache, which saves memory bandwidth when the
+     * destination is much larger than the last level cache. They are weakly ordered,
+     * stream_fence() must be called by every thread that issued some of them before
+     * the data is read by another thread.
+     *
+     * has_stream_store<V> is true if store_stream is available for V, which is
+     * either a scalar type or a batch type.
+     */
+    template <class V, class = void>
+    struct has_stream_store : std::false_type
+    {
+    };
+
+#if defined(XTENSOR_SSE2_STREAM_STORE)
+    template <class T>
+    using is_stream_scalar = std::conjunction<std::is_arithmetic<T>, std::negation<std::is_same<T, bool>>>;
+
+    template <class T>
+    struct has_stream_store<T, std::enable_if_t<is_stream_scalar<T>::value>>
+#if defined(__x86_64__) || defined(_M_X64)
+        : std::bool_constant<sizeof(T) == 4 || sizeof(T) == 8>
+#else
+        : std::bool_constant<sizeof(T) == 4>
+#endif
+    {
+    };
+
+    template <class T>
+    inline void store_stream(T* dst, const T& value)
+    {
+        if constexpr (sizeof(T) == 4)
+        {
+            int bits;
+            std::memcpy(&bits, &value, sizeof(T));
+            _mm_stream_si32(reinterpret_cast<int*>(dst), bits);
+        }
+        else
+        {
+            long long bits;
+            std::memcpy(&bits, &value, sizeof(T));
+            _mm_stream_si64(reinterpret_cast<long long*>(dst), bits);
+        }
+    }
+
+#if defined(XTENSOR_USE_XSIMD)
+    namespace detail
+    {
+        // Register types are dispatched on their size rather than compared
+        // with the intrinsic types, whose attributes are dropped when they
+        // are used as template arguments.
+        template <class R>
+        struct is_stream_register_size
+            : std::bool_constant<
+                  sizeof(R) == 16
+#if defined(__AVX__)
+                  || sizeof(R) == 32
+#endif
+#if defined(__AVX512F__)
+                  || sizeof(R) == 64
+#endif
+                  >
+        {
+        };
+    }
+
+    template <class T, class A>
+    struct has_stream_store<xsimd::batch<T, A>, xt::void_t<typename xsimd::batch<T, A>::register_type>>
+        : std::conjunction<
+              is_stream_scalar<T>,
+              std::negation<std::is_class<typename xsimd::batch<T, A>::register_type>>,
+              detail::is_stream_register_size<typename xsimd::batch<T, A>::register_type>>
+    {
+    };
+
+    /**
+     * Stores a batch with a non-temporal store, \p dst must be aligned on
+     * the size of the batch.
+     */
+    template <class T, class A>
+    inline void store_stream(T* dst, const xsimd::batch<T, A>& b)
+    {
+        using register_type = typename xsimd::batch<T, A>::register_type;
+        register_type reg = b;
+        if constexpr (sizeof(register_type) == 16)
+        {
+            if constexpr (std::is_same<T, float>::value)
+            {
+                _mm_stream_ps(reinterpret_cast<float*>(dst), reg);
+            }
+            else if constexpr (std::is_same<T, double>::value)
+            {
+                _mm_stream_pd(reinterpret_cast<double*>(dst), reg);
+            }
+            else
+            {
+                _mm_stream_si128(reinterpret_cast<__m128i*>(dst), reg);
+            }
+        }
+#if defined(__AVX__)
+        else if constexpr (sizeof(register_type) == 32)
+        {
+            if constexpr (std::is_same<T, float>::value)
+            {
+                _mm256_stream_ps(reinterpret_cast<float*>(dst), reg);
+            }
+            else if constexpr (std::is_same<T, double>::value)
+            {
+                _mm256_stream_pd(reinterpret_cast<double*>(dst), reg);
+            }
+            else
+            {
+                _mm256_stream_si256(reinterpret_cast<__m256i*>(dst), reg);
+            }
+        }
+#endif
+#if defined(__AVX512F__)
+        else
+        {
+            if constexpr (std::is_same<T, float>::value)
+            {
+                _mm512_stream_ps(reinterpret_cast<float*>(dst), reg);
+            }
+            else if constexpr (std::is_same<T, double>::value)
+            {
+                _mm512_stream_pd(reinterpret_cast<double*>(dst), reg);
+            }
+            else
+            {
+                _mm512_stream_si512(reinterpret_cast<__m512i*>(dst), reg);
+            }
+        }
+#endif
+    }
+#endif  // XTENSOR_USE_XSIMD
+
+    inline void stream_fence()
+    {
+        _mm_sfence();
+    }
+#else
+    inline void stream_fence()
+    {
+    }
+#endif  // XTENSOR_SSE2_STREAM_STORE
+}
+
+/***************
+ * conversions *
+ ***************/
+
+namespace xt_simd
+{
+    /**
+     * is_convertible_arithmetic<From, To> is true if values of type From are
+     * converted to type To with convert, that is if both are arithmetic types
+     * other than bool and differ.
+     */
+    template <class From, class To>
+    struct is_convertible_arithmetic
+        : std::conjunction<
+              std::is_arithmetic<From>,
+              std::is_arithmetic<To>,
+              std::negation<std::is_same<From, bool>>,
+              std::negation<std::is_same<To, bool>>,
+              std::negation<std::is_same<From, To>>>
+    {
+    };
+
+    namespace detail
+    {
+        using xt::detail::conversion_limit;
+        using xt::detail::is_saturating_conversion;
+    }
+
+    using xt::saturate_cast;
+
+#if defined(XTENSOR_USE_XSIMD)
+    namespace detail
+    {
+        template <class From, class To>
+        using has_batch_cast = std::conjunction<
+            std::bool_constant<sizeof(From) == sizeof(To)>,
+            std::bool_constant<(simd_traits<From>::size > 1)>,
+            std::bool_constant<(simd_traits<To>::size > 1)>>;
+
+        template <class To, class From, class A>
+        inline xsimd::batch<To, A> saturate_batch_cast(const xsimd::batch<From, A>& b) noexcept
+        {
+            using from_batch = xsimd::batch<From, A>;
+            using to_batch = xsimd::batch<To, A>;
+            if constexpr (is_saturating_conversion<From, To>::value)
+            {
+                constexpr From lowest = static_cast<From>((std::numeric_limits<To>::min)());
+                auto in_range = xsimd::select(b == b, xsimd::max(b, from_batch(lowest)), from_batch(0));
+                auto too_high = xsimd::batch_bool_cast<To>(b >= from_batch(conversion_limit<From, To>()));
+                return xsimd::select(
+                    too_high,
+                    to_batch((std::numeric_limits<To>::max)()),
+                    xsimd::batch_cast<To>(in_range)
+                );
+            }
+            else
+            {
+                return xsimd::batch_cast<To>(b);
+            }
+        }
+    }
+#endif
+
+    /**
+     * Converts the \p size values of \p src with saturate_cast and writes them
+     * to \p dst. Types of the same size are converted batch by batch; other
+     * conversions use a plain loop over the buffers, that compilers turn into
+     * packed conversion instructions.
+     */
+    template <class From, class To>
+    inline void convert(const From* src, To* dst, std::size_t size) noexcept
+    {
+        std::size_t i = 0;
+#if defined(XTENSOR_USE_XSIMD)
+        if constexpr (detail::has_batch_cast<From, To>::value)
+        {
+            using from_batch = xsimd::batch<From>;
+            constexpr std::size_t batch_size = from_batch::size;
+            for (; i + batch_size <= size; i += batch_size)
+            {
+                auto b = from_batch::load_unaligned(src + i);
+                detail::saturate_batch_cast<To>(b).store_unaligned(dst + i);
+            }
+        }
+#endif
+        for (; i < size; ++i)
+        {
+            dst[i] = saturate_cast<To>(src[i]);
+        }
+    }
+}
+
 namespace xt
 {
     using xt_simd::aligned_mode;
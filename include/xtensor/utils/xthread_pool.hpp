@@ -0,0 +1,411 @@
+/***************************************************************************
+ * Copyright (c) Johan Mabille, Sylvain Corlay and Wolf Vollprecht          *
+ * Copyright (c) QuantStack                                                 *
+ *                                                                          *
+ * Distributed under the terms of the BSD 3-Clause License.                 *
+ *                                                                          *
+ * The full license is in the file LICENSE, distributed with this software. *
+ ****************************************************************************/
+
+#ifndef XTENSOR_THREAD_POOL_HPP
+#define XTENSOR_THREAD_POOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../core/xtensor_config.hpp"
+
+namespace xt
+{
+    namespace detail
+    {
+        inline std::size_t hardware_concurrency() noexcept
+        {
+            std::size_t n = static_cast<std::size_t>(std::thread::hardware_concurrency());
+            return n != 0 ? n : std::size_t(1);
+        }
+
+        inline bool& in_thread_pool_task() noexcept
+        {
+            static thread_local bool in_task = false;
+            return in_task;
+        }
+    }
+
+    /**
+     * @class thread_pool
+     * @brief Persistent pool of ``std::thread`` workers running parallel loops.
+     *
+     * The pool backs the ``xt::execution::par_threads`` execution policy, which is
+     * available even when neither TBB nor OpenMP can be used. Workers are started
+     * once and sleep between loops. A loop is split in a few chunks per thread;
+     * each worker first runs the chunks it has been given, in order, then steals
+     * chunks from the other workers, so that unbalanced loops keep every thread
+     * busy. The calling thread takes part in the loop.
+     *
+     * Loops started from within a chunk of another loop run sequentially on
+     * the calling thread.
+     */
+    class thread_pool
+    {
+    public:
+
+        static constexpr std::size_t chunks_per_thread = 4;
+
+        explicit thread_pool(std::size_t nb_threads = detail::hardware_concurrency());
+        ~thread_pool();
+
+        thread_pool(const thread_pool&) = delete;
+        thread_pool& operator=(const thread_pool&) = delete;
+        thread_pool(thread_pool&&) = delete;
+        thread_pool& operator=(thread_pool&&) = delete;
+
+        std::size_t size() const noexcept;
+        void resize(std::size_t nb_threads);
+
+        template <class F>
+        void parallel_for(std::size_t first, std::size_t last, F&& f, std::size_t grain = 1);
+
+        static thread_pool& global();
+
+    private:
+
+        struct job_base
+        {
+            virtual ~job_base() = default;
+            virtual void run(std::size_t first, std::size_t last) = 0;
+
+            void complete(std::size_t nb_tasks);
+            void wait();
+
+            std::atomic<std::size_t> m_remaining{0};
+            std::mutex m_mutex;
+            std::condition_variable m_cv;
+            std::exception_ptr m_error;
+        };
+
+        template <class F>
+        struct job : job_base
+        {
+            explicit job(F& f);
+            void run(std::size_t first, std::size_t last) override;
+
+            F& m_f;
+        };
+
+        struct task
+        {
+            job_base* p_job;
+            std::size_t m_first;
+            std::size_t m_last;
+        };
+
+        struct task_queue
+        {
+            std::mutex m_mutex;
+            std::deque<task> m_tasks;
+        };
+
+        void start(std::size_t nb_threads);
+        void stop();
+
+        void worker_loop(std::size_t index);
+        bool pop_task(std::size_t index, task& t);
+        void run_task(const task& t);
+
+        // Queue 0 is shared by the threads calling parallel_for,
+        // queue i belongs to worker i.
+        std::vector<std::unique_ptr<task_queue>> m_queues;
+        std::vector<std::thread> m_workers;
+        std::mutex m_mutex;
+        std::condition_variable m_cv;
+        std::atomic<std::size_t> m_pending;
+        bool m_stop;
+    };
+
+    void set_num_threads(std::size_t nb_threads);
+    std::size_t get_num_threads();
+
+    /******************************
+     * thread_pool implementation *
+     ******************************/
+
+    /**
+     * Builds a pool running loops on \p nb_threads threads, the calling
+     * thread included. A value of 0 stands for the number of hardware threads.
+     */
+    inline thread_pool::thread_pool(std::size_t nb_threads)
+        : m_pending(0)
+        , m_stop(false)
+    {
+        start(nb_threads);
+    }
+
+    inline thread_pool::~thread_pool()
+    {
+        stop();
+    }
+
+    /**
+     * Returns the number of threads running a loop, the calling thread included.
+     */
+    inline std::size_t thread_pool::size() const noexcept
+    {
+        return m_queues.size();
+    }
+
+    /**
+     * Changes the number of threads of the pool. This must not be called while
+     * a loop is running on the pool.
+     */
+    inline void thread_pool::resize(std::size_t nb_threads)
+    {
+        stop();
+        start(nb_threads);
+    }
+
+    /**
+     * Calls \p f(chunk_first, chunk_last) on contiguous chunks of at least
+     * \p grain indices covering [first, last), and returns once all of them
+     * have been processed. If
+     * a chunk throws, the first exception is rethrown on the calling thread
+     * after the remaining chunks are done.
+     */
+    template <class F>
+    inline void thread_pool::parallel_for(std::size_t first, std::size_t last, F&& f, std::size_t grain)
+    {
+        if (first >= last)
+        {
+            return;
+        }
+
+        std::size_t size = last - first;
+        std::size_t nb_threads = m_queues.size();
+        std::size_t max_chunks = size / std::max(grain, std::size_t(1));
+        std::size_t nb_chunks = std::min(max_chunks, nb_threads * chunks_per_thread);
+        if (nb_threads < 2 || nb_chunks < 2 || detail::in_thread_pool_task())
+        {
+            f(first, last);
+            return;
+        }
+
+        job<std::remove_reference_t<F>> j(f);
+        j.m_remaining.store(nb_chunks);
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_pending += nb_chunks;
+        }
+        // Every thread gets a contiguous range of chunks
+        for (std::size_t i = 0; i < nb_chunks; ++i)
+        {
+            task_queue& q = *m_queues[i * nb_threads / nb_chunks];
+            std::lock_guard<std::mutex> lock(q.m_mutex);
+            q.m_tasks.push_back(task{&j, first + size * i / nb_chunks, first + size * (i + 1) / nb_chunks});
+        }
+        m_cv.notify_all();
+
+        task t;
+        while (j.m_remaining.load() != 0 && pop_task(0, t))
+        {
+            run_task(t);
+        }
+        j.wait();
+
+#if !defined(XTENSOR_DISABLE_EXCEPTIONS)
+        if (j.m_error)
+        {
+            std::rethrow_exception(j.m_error);
+        }
+#endif
+    }
+
+    /**
+     * Returns the pool used by the ``xt::execution::par_threads`` policy.
+     */
+    inline thread_pool& thread_pool::global()
+    {
+        static thread_pool pool;
+        return pool;
+    }
+
+    inline void thread_pool::start(std::size_t nb_threads)
+    {
+        if (nb_threads == 0)
+        {
+            nb_threads = detail::hardware_concurrency();
+        }
+        m_stop = false;
+        m_queues.clear();
+        for (std::size_t i = 0; i < nb_threads; ++i)
+        {
+            m_queues.push_back(std::make_unique<task_queue>());
+        }
+        m_workers.reserve(nb_threads - 1);
+        for (std::size_t i = 1; i < nb_threads; ++i)
+        {
+            m_workers.emplace_back(&thread_pool::worker_loop, this, i);
+        }
+    }
+
+    inline void thread_pool::stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_cv.notify_all();
+        for (auto& w : m_workers)
+        {
+            w.join();
+        }
+        m_workers.clear();
+    }
+
+    inline void thread_pool::worker_loop(std::size_t index)
+    {
+        task t;
+        while (true)
+        {
+            if (pop_task(index, t))
+            {
+                run_task(t);
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv.wait(
+                lock,
+                [this]()
+                {
+                    return m_stop || m_pending.load() != 0;
+                }
+            );
+            if (m_stop && m_pending.load() == 0)
+            {
+                return;
+            }
+            lock.unlock();
+            // Tasks may be counted while still being pushed
+            std::this_thread::yield();
+        }
+    }
+
+    /**
+     * Pops the next task of queue \p index, or steals the last task of
+     * another queue if that one is empty.
+     */
+    inline bool thread_pool::pop_task(std::size_t index, task& t)
+    {
+        std::size_t nb_queues = m_queues.size();
+        for (std::size_t i = 0; i < nb_queues; ++i)
+        {
+            task_queue& q = *m_queues[(index + i) % nb_queues];
+            std::lock_guard<std::mutex> lock(q.m_mutex);
+            if (!q.m_tasks.empty())
+            {
+                if (i == 0)
+                {
+                    t = q.m_tasks.front();
+                    q.m_tasks.pop_front();
+                }
+                else
+                {
+                    t = q.m_tasks.back();
+                    q.m_tasks.pop_back();
+                }
+                m_pending.fetch_sub(1);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    inline void thread_pool::run_task(const task& t)
+    {
+        bool& in_task = detail::in_thread_pool_task();
+        bool was_in_task = in_task;
+        in_task = true;
+#if defined(XTENSOR_DISABLE_EXCEPTIONS)
+        t.p_job->run(t.m_first, t.m_last);
+#else
+        try
+        {
+            t.p_job->run(t.m_first, t.m_last);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(t.p_job->m_mutex);
+            if (!t.p_job->m_error)
+            {
+                t.p_job->m_error = std::current_exception();
+            }
+        }
+#endif
+        in_task = was_in_task;
+        t.p_job->complete(1);
+    }
+
+    inline void thread_pool::job_base::complete(std::size_t nb_tasks)
+    {
+        // The last task notifies under the lock, so that the job cannot be
+        // destroyed by the waiting thread before the notification is done.
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_remaining.fetch_sub(nb_tasks) == nb_tasks)
+        {
+            m_cv.notify_all();
+        }
+    }
+
+    inline void thread_pool::job_base::wait()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait(
+            lock,
+            [this]()
+            {
+                return m_remaining.load() == 0;
+            }
+        );
+    }
+
+    template <class F>
+    inline thread_pool::job<F>::job(F& f)
+        : m_f(f)
+    {
+    }
+
+    template <class F>
+    inline void thread_pool::job<F>::run(std::size_t first, std::size_t last)
+    {
+        m_f(first, last);
+    }
+
+    /**
+     * Sets the number of threads used by the ``xt::execution::par_threads``
+     * policy, the calling thread included. A value of 0 restores the number
+     * of hardware threads. This must not be called while a parallel loop
+     * is running.
+     */
+    inline void set_num_threads(std::size_t nb_threads)
+    {
+        thread_pool::global().resize(nb_threads);
+    }
+
+    /**
+     * Returns the number of threads used by the ``xt::execution::par_threads``
+     * policy, the calling thread included.
+     */
+    inline std::size_t get_num_threads()
+    {
+        return thread_pool::global().size();
+    }
+}
+
+#endif
@@ -17,6 +17,7 @@
 #include <cstddef>
 #include <initializer_list>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <tuple>
 #include <type_traits>
@@ -661,6 +662,53 @@ namespace xt
 #endif
 #undef XTENSOR_GLIBCXX_USE_CXX11_ABI
 
+    /************************
+     * saturating type cast *
+     ************************/
+
+    namespace detail
+    {
+        template <class From, class To>
+        using is_saturating_conversion = std::conjunction<
+            std::is_floating_point<From>,
+            std::is_integral<To>,
+            std::negation<std::is_same<To, bool>>>;
+
+        // First power of two that does not fit in To, it is exactly
+        // representable in any floating point type From.
+        template <class From, class To>
+        constexpr From conversion_limit() noexcept
+        {
+            return static_cast<From>(std::numeric_limits<To>::max() / 2 + 1) * From(2);
+        }
+    }
+
+    /**
+     * Converts \p value to To like static_cast, except for floating point values
+     * that are out of the range of an integral type To, whose static_cast is
+     * undefined: they saturate to the bounds of To, and NaN converts to 0.
+     */
+    template <class To, class From>
+    inline To saturate_cast(From value) noexcept
+    {
+        if constexpr (detail::is_saturating_conversion<From, To>::value)
+        {
+            if (!(value == value))
+            {
+                return To(0);
+            }
+            if (value >= detail::conversion_limit<From, To>())
+            {
+                return (std::numeric_limits<To>::max)();
+            }
+            if (value <= static_cast<From>((std::numeric_limits<To>::min)()))
+            {
+                return (std::numeric_limits<To>::min)();
+            }
+        }
+        return static_cast<To>(value);
+    }
+
     /*************************
      * conditional type cast *
      *************************/
@@ -679,7 +727,14 @@ namespace xt
         template <class U>
         inline auto operator()(U&& u) const
         {
-            return static_cast<T>(std::forward<U>(u));
+            if constexpr (detail::is_saturating_conversion<std::decay_t<U>, T>::value)
+            {
+                return saturate_cast<T>(u);
+            }
+            else
+            {
+                return static_cast<T>(std::forward<U>(u));
+            }
         }
     };
 
@@ -690,6 +745,8 @@ namespace xt
      * static_cast would force undesired type conversions in some situations where
      * an error or warning would be desired. The condition determines when the
      * explicit cast is ok.
+     * Floating point values cast to an integral type go through \ref saturate_cast,
+     * so that NaN and out of range values convert the same way in every assigner.
      */
     template <bool condition, class T, class U>
     inline auto conditional_cast(U&& u)
@@ -7,6 +7,8 @@
  * The full license is in the file LICENSE, distributed with this software. *
  ****************************************************************************/
 
+#include <numeric>
+
 #include "xtensor/containers/xarray.hpp"
 #include "xtensor/containers/xfixed.hpp"
 #include "xtensor/containers/xtensor.hpp"
@@ -15,6 +17,7 @@
 #include "xtensor/generators/xrandom.hpp"
 #include "xtensor/misc/xmanipulation.hpp"
 #include "xtensor/reducers/xaccumulator.hpp"
+#include "xtensor/views/xview.hpp"
 
 #include "test_common_macros.hpp"
 
@@ -208,4 +211,43 @@ namespace xt
         auto result2 = xt::cumsum(a, 1);
         EXPECT_EQ(result2, expected);
     }
+
+    template <layout_type L>
+    void check_long_cumsum()
+    {
+        // 5000 lanes of long span two tiles of the scan along the outer axis
+        xarray<long, L> a = xt::random::randint<long>({3, 5000}, -100, 100);
+
+        auto res_0 = cumsum(a, 0);
+        auto res_1 = cumsum(a, 1);
+        auto res = cumsum(a);
+        xarray<long, L> expected_0 = a;
+        xarray<long, L> expected_1 = a;
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+            auto row = xt::row(expected_1, static_cast<std::ptrdiff_t>(i));
+            std::partial_sum(row.begin(), row.end(), row.begin());
+        }
+        for (std::size_t j = 0; j < 5000; ++j)
+        {
+            auto col = xt::col(expected_0, static_cast<std::ptrdiff_t>(j));
+            std::partial_sum(col.begin(), col.end(), col.begin());
+        }
+        xarray<long> expected = xt::flatten(a);
+        std::partial_sum(expected.begin(), expected.end(), expected.begin());
+        EXPECT_EQ(expected_0, res_0);
+        EXPECT_EQ(expected_1, res_1);
+        EXPECT_EQ(expected, res);
+    }
+
+    TEST(xaccumulator, long_axes)
+    {
+        check_long_cumsum<layout_type::row_major>();
+        check_long_cumsum<layout_type::column_major>();
+
+        xarray<double> a = 1. + 1e-4 * xt::arange<double>(20000);
+        xarray<double> expected = a;
+        std::partial_sum(expected.begin(), expected.end(), expected.begin(), std::multiplies<double>());
+        EXPECT_TRUE(allclose(expected, cumprod(a)));
+    }
 }
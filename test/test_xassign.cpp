@@ -7,14 +7,24 @@
  * The full license is in the file LICENSE, distributed with this software. *
  ****************************************************************************/
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
 #include <iterator>
+#include <limits>
 #include <type_traits>
 #include <vector>
 
+#include "xtensor/containers/xadapt.hpp"
 #include "xtensor/containers/xarray.hpp"
 #include "xtensor/containers/xtensor.hpp"
 #include "xtensor/core/xassign.hpp"
 #include "xtensor/core/xnoalias.hpp"
+#include "xtensor/generators/xbuilder.hpp"
+#include "xtensor/misc/xmanipulation.hpp"
+#include "xtensor/views/xindex_view.hpp"
+#include "xtensor/views/xstrided_view.hpp"
+#include "xtensor/views/xview.hpp"
 
 #include "test_common.hpp"
 #include "test_common_macros.hpp"
@@ -167,4 +177,251 @@ namespace xt
             EXPECT_EQ(a.shape(1), 3);
         }
     }
+
+    TEST(xassign, assign_all)
+    {
+        xarray<double> x = {{1., 2., 3.}, {4., 5., 6.}};
+        xarray<double> y = {{6., 5., 4.}, {3., 2., 1.}};
+        xarray<double> s, d;
+        assign_all(std::tie(s, d), x + y, x - y);
+        EXPECT_EQ(s, xarray<double>(x + y));
+        EXPECT_EQ(d, xarray<double>(x - y));
+
+        // non contiguous outputs and broadcasting go through the stepper path
+        xarray<double> row = {1., 2., 3.};
+        xtensor<double, 2> m = zeros<double>({4, 6});
+        xtensor<double, 2> n = zeros<double>({2, 3});
+        auto v = view(m, range(0, 4, 2), range(1, 4));
+        assign_all(std::tie(v, n), x * row, row - x);
+        EXPECT_EQ(v, xarray<double>(x * row));
+        EXPECT_EQ(m(1, 1), 0.);
+        EXPECT_EQ(n, xarray<double>(row - x));
+
+        // conversions
+        xarray<int> i;
+        xarray<float> f;
+        assign_all(std::tie(i, f), x * 2., y);
+        EXPECT_EQ(i(1, 2), 12);
+        EXPECT_EQ(f(0, 1), 5.f);
+
+        // outputs of different shapes
+        xarray<double> r;
+        assign_all(std::tie(s, r), x, row);
+        EXPECT_EQ(s, x);
+        EXPECT_EQ(r, row);
+    }
+
+    TEST(xassign, assign_all_aliasing)
+    {
+        // every expression is evaluated before the outputs are written
+        xarray<double> a = arange<double>(100.);
+        xarray<double> b = zeros<double>({100});
+        xarray<double> expected_a = a + b + 1.;
+        xarray<double> expected_b = a * 2.;
+        assign_all(std::tie(a, b), a + b + 1., a * 2.);
+        EXPECT_EQ(a, expected_a);
+        EXPECT_EQ(b, expected_b);
+    }
+
+    TEST(xassign, tiled_assign)
+    {
+        xtensor<double, 2> a = reshape_view(arange<double>(100. * 70.), {100, 70});
+        xtensor<double, 2> t = transpose(a);
+        ASSERT_EQ(t.shape()[0], 70u);
+        bool same = true;
+        for (std::size_t i = 0; i < 70; ++i)
+        {
+            for (std::size_t j = 0; j < 100; ++j)
+            {
+                same = same && t(i, j) == a(j, i);
+            }
+        }
+        EXPECT_TRUE(same);
+
+        // layout conversion with a value type conversion
+        xtensor<float, 2, layout_type::column_major> c = a;
+        xtensor<int, 2> r = c;
+        xtensor<int, 2> expected = a;
+        EXPECT_EQ(r, expected);
+
+        // axis permutations of a 3-D array, to a container and to a view
+        xarray<int> b = reshape_view(arange<int>(6 * 50 * 40), {6, 50, 40});
+        xarray<int> s = swapaxes(b, 0, 2);
+        EXPECT_EQ(s(39, 49, 5), b(5, 49, 39));
+        EXPECT_EQ(s(3, 17, 2), b(2, 17, 3));
+        xarray<int> m = moveaxis(b, 2, 0);
+        EXPECT_EQ(m(33, 4, 21), b(4, 21, 33));
+
+        xarray<int> res = zeros<int>({50, 42, 6});
+        auto v = view(res, all(), range(1, 41), all());
+        v = transpose(b, {1, 2, 0});
+        EXPECT_EQ(res(27, 0, 3), 0);
+        EXPECT_EQ(res(27, 6, 3), b(3, 27, 5));
+        EXPECT_EQ(res(49, 40, 5), b(5, 49, 39));
+
+        // largest tiles that fit in a quarter of the default 32 KB L1 cache
+#if XTENSOR_L1_CACHE_SIZE == 32768
+        EXPECT_EQ((tiled_assign_detail::tile_size<double, double>()), 16u);
+        EXPECT_EQ((tiled_assign_detail::tile_size<float, float>()), 32u);
+        EXPECT_EQ((tiled_assign_detail::tile_size<std::int8_t, std::int8_t>()), 64u);
+#endif
+    }
+
+    TEST(xassign, conversion_assign)
+    {
+        // sizes that are not multiples of the blocks nor of the batches
+        xarray<double> a = arange<double>(-1500., 1503.) * 0.75;
+        xarray<float> f = a;
+        xarray<float> expected_f = cast<float>(a);
+        EXPECT_EQ(f, expected_f);
+
+        xarray<int> i = a;
+        EXPECT_EQ(i(0), -1125);
+        EXPECT_EQ(i(3001), 1125);
+        EXPECT_EQ(i(1501), 0);
+
+        xarray<double> d = i + 1;
+        EXPECT_EQ(d(0), -1124.);
+        EXPECT_EQ(d(3002), 1127.);
+
+        xarray<std::int8_t> narrow = arange<std::int64_t>(1000);
+        EXPECT_EQ(narrow(300), static_cast<std::int8_t>(300));
+
+        // strided destination and source
+        xtensor<float, 2> t = zeros<float>({40, 60});
+        auto v = view(t, range(1, 39), range(2, 58));
+        xtensor<double, 2> s = reshape_view(arange<double>(38. * 56.), {38, 56});
+        v = s * 2.;
+        EXPECT_EQ(t(0, 2), 0.f);
+        EXPECT_EQ(t(1, 1), 0.f);
+        EXPECT_EQ(t(1, 2), 0.f);
+        EXPECT_EQ(t(1, 3), 2.f);
+        EXPECT_EQ(t(38, 57), static_cast<float>(2. * (38. * 56. - 1.)));
+
+        // out of range floating point values saturate
+        const double inf = std::numeric_limits<double>::infinity();
+        const double nan = std::numeric_limits<double>::quiet_NaN();
+        std::vector<double> src = {1e20, -1e20, inf, -inf, nan, 2147483647.5, -2147483648.5, -3.75};
+        std::vector<std::int32_t> dst(src.size());
+        xt_simd::convert(src.data(), dst.data(), src.size());
+        std::vector<std::int32_t> expected = {
+            std::numeric_limits<std::int32_t>::max(),
+            std::numeric_limits<std::int32_t>::min(),
+            std::numeric_limits<std::int32_t>::max(),
+            std::numeric_limits<std::int32_t>::min(),
+            0,
+            std::numeric_limits<std::int32_t>::max(),
+            std::numeric_limits<std::int32_t>::min(),
+            -3
+        };
+        EXPECT_EQ(dst, expected);
+        EXPECT_EQ(xt_simd::saturate_cast<std::uint8_t>(-1.f), 0);
+        EXPECT_EQ(xt_simd::saturate_cast<std::uint8_t>(255.9f), 255);
+        EXPECT_EQ(xt_simd::saturate_cast<std::uint8_t>(256.f), 255);
+
+        // every assignment path converts like saturate_cast, with or without xsimd
+        const std::int32_t max = std::numeric_limits<std::int32_t>::max();
+        const std::int32_t min = std::numeric_limits<std::int32_t>::min();
+        xtensor<double, 1> row = {1e20, -1e20, nan, -3.75};
+        xtensor<std::int32_t, 1> expected_row = {max, min, 0, -3};
+        xtensor<std::int32_t, 1> contiguous = row;
+        EXPECT_EQ(contiguous, expected_row);
+        xtensor<double, 2> rows = row + zeros<double>({3, 4});
+        xtensor<std::int32_t, 2> broadcast = row + zeros<double>({3, 4});
+        xtensor<std::int32_t, 2> transposed = transpose(rows);
+        xtensor<std::int32_t, 2> fused;
+        assign_all(std::tie(fused), row + zeros<double>({3, 4}));
+        for (std::size_t k = 0; k < 3; ++k)
+        {
+            EXPECT_EQ(view(broadcast, k), expected_row);
+            EXPECT_EQ(view(transposed, all(), k), expected_row);
+            EXPECT_EQ(view(fused, k), expected_row);
+        }
+    }
+
+    TEST(xassign, simd_tails)
+    {
+        // unaligned heads and tails of every length
+        for (std::size_t n = 1; n < 40; ++n)
+        {
+            xarray<double> a = arange<double>(double(n));
+            std::vector<double> buffer(n + 4, 0.);
+            for (std::size_t offset = 0; offset < 4; ++offset)
+            {
+                std::fill(buffer.begin(), buffer.end(), 0.);
+                auto res = adapt(buffer.data() + offset, n, no_ownership(), std::array<std::size_t, 1>{n});
+                res = a * 2.;
+                // element-wise aliasing
+                noalias(res) = res + 1.;
+                bool same = true;
+                for (std::size_t i = 0; i < buffer.size(); ++i)
+                {
+                    bool inside = i >= offset && i < offset + n;
+                    same = same && buffer[i] == (inside ? 2. * a(i - offset) + 1. : 0.);
+                }
+                EXPECT_TRUE(same);
+            }
+        }
+
+        // short inner loops
+        for (std::size_t n = 2; n < 20; ++n)
+        {
+            xtensor<int, 2> a = reshape_view(arange<int>(int(7 * n)), {std::size_t(7), n});
+            xtensor<int, 2> res = zeros<int>({std::size_t(7), n + 2});
+            auto v = view(res, all(), range(1, n + 1));
+            v = a * 3;
+            noalias(v) = v + a;
+            bool same = true;
+            for (std::size_t i = 0; i < 7; ++i)
+            {
+                same = same && res(i, 0) == 0 && res(i, n + 1) == 0;
+                for (std::size_t j = 0; j < n; ++j)
+                {
+                    same = same && res(i, j + 1) == 4 * a(i, j);
+                }
+            }
+            EXPECT_TRUE(same);
+        }
+    }
+
+    TEST(xassign, trace)
+    {
+        xtensor<double, 2> a = reshape_view(arange<double>(100. * 70.), {100, 70});
+        xarray<double> s = zeros<double>({100, 5});
+        xarray<double> flat = ravel(a);
+        xarray<std::size_t> idx = {3, 1, 4};
+
+        std::vector<assign_trace> traces;
+        assign_trace_callback previous = set_assign_trace_callback(
+            [&traces](const assign_trace& t)
+            {
+                traces.push_back(t);
+            }
+        );
+        xtensor<double, 2> res = a * 2.;
+        xtensor<double, 2> t = transpose(a);
+        view(s, all(), range(1, 4)) = view(a, all(), range(0, 3)) + 1.;
+        xarray<double> picked = index_view(flat, idx);
+        set_assign_trace_callback(previous);
+        xtensor<double, 2> untraced = a + 1.;
+
+#if defined(XTENSOR_ENABLE_ASSIGN_TRACE)
+        ASSERT_EQ(traces.size(), 4u);
+        EXPECT_EQ(traces[0].path, assign_path::linear);
+        EXPECT_EQ(traces[0].size, 7000u);
+        EXPECT_EQ(traces[0].dimension, 2u);
+        EXPECT_EQ(traces[1].path, assign_path::tiled);
+        EXPECT_GT(traces[1].inner_loop_size, 0u);
+        EXPECT_NE(traces[2].path, assign_path::linear);
+        EXPECT_EQ(traces[2].size, 300u);
+        EXPECT_EQ(traces[3].path, assign_path::stepper);
+        EXPECT_FALSE(traces[3].simd);
+        EXPECT_EQ(traces[3].size, 3u);
+#else
+        EXPECT_TRUE(traces.empty());
+#endif
+        EXPECT_EQ(picked(2), flat(4));
+        EXPECT_EQ(untraced(0, 1), 2.);
+        EXPECT_FALSE(get_assign_trace_callback());
+    }
 }
@@ -237,6 +237,36 @@ namespace xt
         }
         TEST_CASE_TEMPLATE_APPLY(test_p_norm_values_id, test_p_norm_values_test_types);
 
+        TEST_CASE("describe")
+        {
+            dynamic_shape<std::size_t> shape({21, 10, 5});
+            dynamic_shape<std::size_t> chunk_shape({5, 4, 2});
+            xarray<int> input_exp(shape);
+
+            // repeated values, whose first extrema are not in the first block
+            for (std::size_t i = 0; i < input_exp.size(); ++i)
+            {
+                input_exp.flat(i) = static_cast<int>((i * 7 + 3) % 11);
+            }
+
+            for (std::ptrdiff_t axis = 0; axis < 3; ++axis)
+            {
+                SUBCASE((std::string("axis = ") + std::to_string(axis)).c_str())
+                {
+                    auto result = xt::blockwise::describe(input_exp, chunk_shape, axis);
+                    auto should_result = xt::describe(input_exp, axis);
+                    CHECK_EQ(result.count, should_result.count);
+                    CHECK_EQ(result.sum, should_result.sum);
+                    CHECK_UNARY(xt::allclose(result.mean, should_result.mean));
+                    CHECK_UNARY(xt::allclose(result.variance, should_result.variance));
+                    CHECK_EQ(result.min, should_result.min);
+                    CHECK_EQ(result.max, should_result.max);
+                    CHECK_EQ(result.argmin, should_result.argmin);
+                    CHECK_EQ(result.argmax, should_result.argmax);
+                }
+            }
+        }
+
         TEST_CASE("test_api")
         {
             SUBCASE("sum")
@@ -0,0 +1,649 @@
+/***************************************************************************
+ * Copyright (c) Johan Mabille, Sylvain Corlay and Wolf Vollprecht          *
+ * Copyright (c) QuantStack                                                 *
+ *                                                                          *
+ * Distributed under the terms of the BSD 3-Clause License.                 *
+ *                                                                          *
+ * The full license is in the file LICENSE, distributed with this software. *
+ ****************************************************************************/
+
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include "xtensor/containers/xarray.hpp"
+#include "xtensor/containers/xtensor.hpp"
+#include "xtensor/core/xeval.hpp"
+#include "xtensor/core/xexecution.hpp"
+#include "xtensor/core/xmath.hpp"
+#include "xtensor/core/xnoalias.hpp"
+#include "xtensor/views/xindex_view.hpp"
+#include "xtensor/generators/xbuilder.hpp"
+#include "xtensor/misc/xsort.hpp"
+#include "xtensor/reducers/xblockwise_reducer.hpp"
+#include "xtensor/views/xview.hpp"
+
+#include "test_common.hpp"
+
+namespace xt
+{
+    namespace
+    {
+        const execution_policy policies[] = {
+            execution::seq,
+            execution::par,
+            execution::par_tbb,
+            execution::par_openmp,
+            execution::par_threads
+        };
+
+        // Runs every loop of a parallel policy in parallel, on several threads
+        // even on a single core machine, so that small test arrays go through
+        // the parallel code paths.
+        class always_parallel
+        {
+        public:
+
+            always_parallel()
+                : m_previous(get_parallel_cost_model())
+                , m_nb_threads(get_num_threads())
+            {
+                set_parallel_cost_model(parallel_cost_model{0, 1});
+                set_num_threads(4);
+            }
+
+            ~always_parallel()
+            {
+                set_parallel_cost_model(m_previous);
+                set_num_threads(m_nb_threads);
+            }
+
+        private:
+
+            parallel_cost_model m_previous;
+            std::size_t m_nb_threads;
+        };
+    }
+
+    TEST(xexecution, resolved_backend)
+    {
+        EXPECT_EQ(execution::seq.resolved_backend(), execution_backend::sequential);
+        EXPECT_EQ(execution::par_threads.resolved_backend(), execution_backend::threads);
+        EXPECT_FALSE(execution::seq.is_parallel());
+        EXPECT_TRUE(execution::par.is_parallel());
+        EXPECT_FALSE(execution::seq.use_parallel(std::size_t(1) << 20));
+        EXPECT_NE(execution::par.resolved_backend(), execution_backend::parallel);
+#if !defined(XTENSOR_USE_TBB)
+        EXPECT_NE(execution::par_tbb.resolved_backend(), execution_backend::tbb);
+#endif
+#if !defined(XTENSOR_USE_OPENMP)
+        EXPECT_NE(execution::par_openmp.resolved_backend(), execution_backend::openmp);
+#endif
+    }
+
+    TEST(xexecution, parallel_for)
+    {
+        always_parallel guard;
+        for (const auto& policy : policies)
+        {
+            std::vector<int> visited(1000, 0);
+            detail::parallel_for(
+                policy,
+                std::size_t(0),
+                visited.size(),
+                [&visited](std::size_t first, std::size_t last)
+                {
+                    for (std::size_t i = first; i < last; ++i)
+                    {
+                        ++visited[i];
+                    }
+                }
+            );
+            EXPECT_TRUE(std::all_of(
+                visited.cbegin(),
+                visited.cend(),
+                [](int v)
+                {
+                    return v == 1;
+                }
+            ));
+        }
+    }
+
+    TEST(xexecution, linear_assign)
+    {
+        always_parallel guard;
+        xarray<double> a = arange<double>(1000.);
+        xarray<double> b = 2. * a;
+        xarray<double> expected = a + b;
+        for (const auto& policy : policies)
+        {
+            xarray<double> res;
+            res.assign(a + b, policy);
+            EXPECT_EQ(res, expected);
+        }
+    }
+
+    TEST(xexecution, conversion_assign)
+    {
+        always_parallel guard;
+        xarray<double> a = arange<double>(20003.) * 0.5;
+        xarray<int> expected = cast<int>(a + 1.);
+        for (const auto& policy : policies)
+        {
+            xarray<int> res;
+            res.assign(a + 1., policy);
+            EXPECT_EQ(res, expected);
+
+            xarray<float> f;
+            f.assign(a, policy);
+            EXPECT_EQ(f(20002), 10001.f);
+        }
+    }
+
+    TEST(xexecution, strided_assign)
+    {
+        always_parallel guard;
+        xtensor<double, 2> a = reshape_view(arange<double>(1200.), {30, 40});
+        xtensor<double, 2> expected = transpose(a) + 1.;
+        for (const auto& policy : policies)
+        {
+            xtensor<double, 2> res;
+            res.assign(transpose(a) + 1., policy);
+            EXPECT_EQ(res, expected);
+        }
+    }
+
+    TEST(xexecution, view_assign)
+    {
+        always_parallel guard;
+        xtensor<double, 2> a = reshape_view(arange<double>(1200.), {30, 40});
+        xtensor<double, 2> expected = zeros<double>({30, 40});
+        view(expected, range(2, 20), range(5, 35)) = view(a, range(2, 20), range(5, 35)) * 3.;
+        for (const auto& policy : policies)
+        {
+            xtensor<double, 2> res = zeros<double>({30, 40});
+            auto v = view(res, range(2, 20), range(5, 35));
+            v.assign(view(a, range(2, 20), range(5, 35)) * 3., policy);
+            EXPECT_EQ(res, expected);
+        }
+    }
+
+    TEST(xexecution, stepper_assign)
+    {
+        always_parallel guard;
+        xarray<double> a = reshape_view(arange<double>(60.), {3, 4, 5});
+        xarray<double> b = arange<double>(5.);
+        xarray<std::size_t> idx = {59, 0, 12, 7, 33};
+
+        xarray<double, layout_type::column_major> expected_bc = a + b;
+        xarray<double> expected_idx = index_view(a, idx) * b;
+        for (const auto& policy : policies)
+        {
+            // broadcasting into a layout different from the operands
+            xarray<double, layout_type::column_major> res_bc(std::vector<std::size_t>{3, 4, 5});
+            stepper_assigner<decltype(res_bc), decltype(a + b), layout_type::column_major>(res_bc, a + b).run(policy);
+            EXPECT_EQ(res_bc, expected_bc);
+
+            xarray<double> res_idx;
+            res_idx.assign(index_view(a, idx) * b, policy);
+            EXPECT_EQ(res_idx, expected_idx);
+
+            xarray<double> res_view = a;
+            auto lhs = index_view(res_view, idx);
+            lhs.assign(b * 2., policy);
+            EXPECT_EQ(res_view.flat(59), 0.);
+            EXPECT_EQ(res_view.flat(33), 8.);
+            EXPECT_EQ(res_view.flat(1), 1.);
+        }
+    }
+
+    TEST(xexecution, noalias)
+    {
+        always_parallel guard;
+        xarray<int> a = arange<int>(500);
+        xarray<int> expected = a * a;
+        for (const auto& policy : policies)
+        {
+            xarray<int> res = zeros<int>({500});
+            noalias(res).assign(a * a, policy);
+            EXPECT_EQ(res, expected);
+        }
+    }
+
+    TEST(xexecution, assign_all)
+    {
+        always_parallel guard;
+        xarray<int> a = arange<int>(500);
+        xarray<int> row = arange<int>(20);
+        xarray<int> m = reshape_view(arange<int>(500), {25, 20});
+        xarray<int> expected_sum = a + a;
+        xarray<int> expected_product = a * a;
+        xarray<int> expected_broadcast = m * row;
+        for (const auto& policy : policies)
+        {
+            xarray<int> s, p, b, r;
+            assign_all(std::tie(s, p), policy, a + a, a * a);
+            EXPECT_EQ(s, expected_sum);
+            EXPECT_EQ(p, expected_product);
+            // outputs of different shapes
+            assign_all(std::tie(b, r), policy, m * row, row);
+            EXPECT_EQ(b, expected_broadcast);
+            EXPECT_EQ(r, row);
+        }
+    }
+
+    TEST(xexecution, eval)
+    {
+        always_parallel guard;
+        xarray<double> a = arange<double>(300.);
+        auto&& same = eval(a, execution::par);
+        EXPECT_EQ(&same, &a);
+
+        xarray<double> expected = a * 2.;
+        for (const auto& policy : policies)
+        {
+            auto res = eval(a * 2., policy);
+            EXPECT_EQ(res, expected);
+        }
+    }
+
+    TEST(xexecution, reduce)
+    {
+        always_parallel guard;
+        xarray<double> a = reshape_view(arange<double>(4. * 3. * 50. * 7.), {4, 3, 50, 7});
+        xarray<double, layout_type::column_major> ca = a;
+        const std::vector<std::vector<std::size_t>> axes_list = {
+            {0, 1, 2, 3},
+            {0},
+            {3},
+            {1, 2},
+            {2, 3},
+            {0, 2},
+            {0, 1, 3}
+        };
+        for (const auto& policy : policies)
+        {
+            for (const auto& axes : axes_list)
+            {
+                xarray<double> expected = sum(
+                    a,
+                    axes,
+                    evaluation_strategy::immediate | with_policy(execution::seq)
+                );
+                xarray<double> res = sum(a, axes, evaluation_strategy::immediate | with_policy(policy));
+                EXPECT_EQ(res, expected);
+                xarray<double> cres = sum(ca, axes, evaluation_strategy::immediate | with_policy(policy));
+                EXPECT_EQ(cres, expected);
+                xarray<double> lazy = sum(a, axes, with_policy(policy));
+                EXPECT_EQ(lazy, expected);
+            }
+
+            EXPECT_EQ(amax(a, with_policy(policy))(), 4. * 3. * 50. * 7. - 1.);
+            EXPECT_EQ(sum(a, with_policy(policy) | initial(2.))(), sum(a)() + 2.);
+            EXPECT_EQ(
+                sum(a, {0, 1}, evaluation_strategy::immediate | keep_dims | with_policy(policy)),
+                sum(a, {0, 1}, keep_dims)
+            );
+        }
+    }
+
+    TEST(xexecution, describe)
+    {
+        always_parallel guard;
+        xarray<int> a = reshape_view(arange<int>(4 * 300 * 7), {4, 300, 7});
+        a = (a * 7 + 3) % 11;
+        xarray<int, layout_type::column_major> ca = a;
+        auto check = [](const auto& res, const auto& expected)
+        {
+            EXPECT_EQ(res.count, expected.count);
+            EXPECT_EQ(res.sum, expected.sum);
+            EXPECT_TRUE(allclose(res.variance, expected.variance));
+            EXPECT_EQ(res.min, expected.min);
+            EXPECT_EQ(res.max, expected.max);
+            EXPECT_EQ(res.argmin, expected.argmin);
+            EXPECT_EQ(res.argmax, expected.argmax);
+        };
+        for (const auto& policy : policies)
+        {
+            check(describe(a, with_policy(policy)), describe(a, with_policy(execution::seq)));
+            check(describe(ca, evaluation_strategy::immediate | with_policy(policy)), describe(a));
+            for (std::ptrdiff_t axis = 0; axis < 3; ++axis)
+            {
+                auto expected = describe(a, axis, with_policy(execution::seq));
+                check(describe(a, axis, with_policy(policy)), expected);
+                check(describe(a, axis, evaluation_strategy::immediate | with_policy(policy)), expected);
+                check(describe(ca, axis, evaluation_strategy::immediate | with_policy(policy)), expected);
+            }
+        }
+    }
+
+    TEST(xexecution, accumulate)
+    {
+        // The accumulators run with the default policy, the expected results are
+        // computed before the guard makes their loops parallel.
+        xarray<int> a = reshape_view(arange<int>(4 * 300 * 7), {4, 300, 7});
+        a = (a * 7 + 3) % 11 - 5;
+        xarray<int, layout_type::column_major> ca = a;
+        xarray<double> b = 1. + 1e-3 * reshape_view(arange<double>(2 * 3000), {2, 3000});
+        // not associative: scanned sequentially along a single long axis
+        auto lhs_minus = []
+        {
+            return make_xaccumulator_functor(
+                [](int lhs, int rhs)
+                {
+                    return 2 * lhs - rhs;
+                },
+                detail::accumulator_identity<int>()
+            );
+        };
+        xarray<int> expected = cumsum(a);
+        xarray<int> expected_minus = accumulate(lhs_minus(), a);
+        std::vector<xarray<int>> expected_axes;
+        for (std::ptrdiff_t axis = 0; axis < 3; ++axis)
+        {
+            expected_axes.push_back(cumsum(a, axis));
+        }
+        xarray<double> expected_prod = cumprod(b, 1);
+
+        always_parallel guard;
+        EXPECT_EQ(cumsum(a), expected);
+        EXPECT_EQ(accumulate(lhs_minus(), a), expected_minus);
+        for (std::ptrdiff_t axis = 0; axis < 3; ++axis)
+        {
+            EXPECT_EQ(cumsum(a, axis), expected_axes[std::size_t(axis)]);
+            EXPECT_EQ(xarray<int>(cumsum(ca, axis)), expected_axes[std::size_t(axis)]);
+        }
+        EXPECT_TRUE(allclose(cumprod(b, 1), expected_prod));
+    }
+
+    TEST(xexecution, argmin_argmax)
+    {
+        xarray<double> a = reshape_view(arange<double>(2 * 30000), {2, 30000});
+        a = sin(a);
+        // NaN values at the beginning of the parallel chunks are ignored
+        for (std::size_t i = 1; i < 4; ++i)
+        {
+            a(1, 30000 * i / 4) = std::numeric_limits<double>::quiet_NaN();
+            a(1, 30000 * i / 4 + 1) = 2. + double(i);
+            a(1, 30000 * i / 4 + 2) = -2. - double(i);
+        }
+        xarray<double> b = view(a, all(), range(0, 6000));
+        b.reshape({12, 1000});
+        auto expected_max = argmax(a);
+        auto expected_min = argmin(a);
+        std::vector<xarray<std::size_t>> expected_axes;
+        for (std::ptrdiff_t axis = 0; axis < 2; ++axis)
+        {
+            expected_axes.push_back(argmax(a, axis));
+            expected_axes.push_back(argmin(a, axis));
+            expected_axes.push_back(argmax(b, axis));
+        }
+
+        always_parallel guard;
+        EXPECT_EQ(argmax(a), expected_max);
+        EXPECT_EQ(argmin(a), expected_min);
+        EXPECT_EQ(argmax(a)(), std::size_t(30000 + 22501));
+        for (std::ptrdiff_t axis = 0; axis < 2; ++axis)
+        {
+            std::size_t i = 3 * std::size_t(axis);
+            EXPECT_EQ(argmax(a, axis), expected_axes[i]);
+            EXPECT_EQ(argmin(a, axis), expected_axes[i + 1]);
+            EXPECT_EQ(argmax(b, axis), expected_axes[i + 2]);
+        }
+    }
+
+    TEST(xexecution, sort)
+    {
+        // Few distinct values, so that stable sorts keep the order of many equivalent elements
+        xarray<int> a = reshape_view(arange<int>(3 * 4001) * 7919 % 101, {3, 4001});
+        xarray<int, layout_type::column_major> ca = a;
+        xarray<int> b = reshape_view(arange<int>(8 * 1500) * 7919 % 101, {8, 1500});
+        std::vector<int> flat(a.begin(), a.end());
+        std::vector<int> sorted_flat = flat;
+        std::sort(sorted_flat.begin(), sorted_flat.end());
+        std::vector<std::size_t> stable_idx(flat.size());
+        std::iota(stable_idx.begin(), stable_idx.end(), std::size_t(0));
+        std::stable_sort(
+            stable_idx.begin(),
+            stable_idx.end(),
+            [&flat](std::size_t i, std::size_t j)
+            {
+                return flat[i] < flat[j];
+            }
+        );
+        // Lanes of the first axis, sorted as the lanes of the leading axis of the transpose
+        xarray<int> at = transpose(a);
+        xarray<int> sorted_columns = transpose(sort(at, 1, execution::seq));
+        const xtensor<double, 1> probas = {0., .25, .5, .99, 1.};
+        auto quantiles = [&probas](const auto& e, std::ptrdiff_t axis)
+        {
+            return quantile(e, probas, axis, quantile_method::weibull, execution::seq);
+        };
+
+        always_parallel guard;
+        for (const auto& policy : policies)
+        {
+            EXPECT_EQ(sort(a, 0, policy), sorted_columns);
+            auto fs = sort(a, xnone(), policy);
+            EXPECT_TRUE(std::equal(fs.begin(), fs.end(), sorted_flat.begin(), sorted_flat.end()));
+            auto fi = argsort(a, xnone(), sorting_method::stable, policy);
+            EXPECT_TRUE(std::equal(fi.begin(), fi.end(), stable_idx.begin(), stable_idx.end()));
+            auto rs = sort(a, xnone(), sorting_method::radix, policy);
+            EXPECT_TRUE(std::equal(rs.begin(), rs.end(), sorted_flat.begin(), sorted_flat.end()));
+            auto ri = argsort(a, xnone(), sorting_method::radix, policy);
+            EXPECT_TRUE(std::equal(ri.begin(), ri.end(), stable_idx.begin(), stable_idx.end()));
+            auto qi = argsort(a, xnone(), sorting_method::quick, policy);
+            EXPECT_EQ(sort(qi, xnone()), arange<std::size_t>(flat.size()));
+            EXPECT_EQ(xt::index_view(a, qi), fs);
+
+            for (std::ptrdiff_t axis = 0; axis < 2; ++axis)
+            {
+                auto expected = sort(a, axis, execution::seq);
+                EXPECT_EQ(sort(a, axis, policy), expected);
+                EXPECT_EQ(sort(ca, axis, policy), expected);
+                EXPECT_EQ(sort(b, axis, policy), sort(b, axis, execution::seq));
+                auto expected_idx = argsort(a, axis, sorting_method::stable, execution::seq);
+                EXPECT_EQ(argsort(a, axis, sorting_method::stable, policy), expected_idx);
+                EXPECT_EQ(argsort(ca, axis, sorting_method::stable, policy), expected_idx);
+                EXPECT_EQ(sort(b, axis, sorting_method::radix, policy), sort(b, axis, execution::seq));
+                EXPECT_EQ(argsort(a, axis, sorting_method::radix, policy), expected_idx);
+                EXPECT_EQ(
+                    argsort(b, axis, sorting_method::stable, policy),
+                    argsort(b, axis, sorting_method::stable, execution::seq)
+                );
+                EXPECT_EQ(
+                    quantile(b, probas, axis, quantile_method::linear, policy),
+                    quantile(b, probas, axis, quantile_method::linear, execution::seq)
+                );
+                EXPECT_EQ(quantile(ca, probas, axis, quantile_method::weibull, policy), quantiles(a, axis));
+                EXPECT_EQ(median(b, axis, policy), median(b, axis, execution::seq));
+            }
+        }
+
+        // A single lane is sorted in parallel, and the thread waiting for it may run the
+        // tasks of another sort, simulated here
+        xarray<int> one_lane = view(at, all(), range(0, 1));
+        xarray<int> sorted_lane = sort(one_lane, 0, execution::seq);
+        xarray<int> other = -at;
+        xarray<int> sorted_other = sort(other, 0, execution::seq);
+        detail::call_over_strided_axis(
+            execution::par,
+            one_lane,
+            0,
+            [&other, &sorted_other](int* first, int* last, const execution_policy& lane_policy)
+            {
+                EXPECT_TRUE(lane_policy.is_parallel());
+                EXPECT_EQ(sort(other, 0, execution::seq), sorted_other);
+                std::sort(first, last);
+            }
+        );
+        EXPECT_EQ(one_lane, sorted_lane);
+
+        // With two chunks, the single merge round leaves the sorted values in the buffer
+        set_num_threads(2);
+        auto fs = sort(a, xnone(), execution::par_threads);
+        EXPECT_TRUE(std::equal(fs.begin(), fs.end(), sorted_flat.begin(), sorted_flat.end()));
+    }
+
+    TEST(xexecution, blockwise_reduce)
+    {
+        always_parallel guard;
+        xarray<int> a = reshape_view(arange<int>(40 * 30 * 6), {40, 30, 6});
+        a = (a * 7 + 3) % 11;
+        std::vector<std::size_t> block_shape = {7, 4, 6};
+        // {1} gives many output chunks, which are computed in parallel, {0, 1, 2} gives
+        // a single one, whose input blocks are split among the threads
+        const std::vector<std::vector<std::size_t>> axes_list = {{1}, {0, 1, 2}};
+        auto evaluate = [](const auto& reducer)
+        {
+            using value_type = typename std::decay_t<decltype(reducer)>::value_type;
+            auto res = xarray<value_type>::from_shape(reducer.shape());
+            reducer.assign_to(res);
+            return res;
+        };
+        for (const auto& policy : policies)
+        {
+            for (const auto& axes : axes_list)
+            {
+                EXPECT_EQ(evaluate(blockwise::sum(a, block_shape, axes, with_policy(policy))), sum(a, axes));
+                EXPECT_TRUE(allclose(
+                    evaluate(blockwise::variance(a, block_shape, axes, with_policy(policy))),
+                    variance(a, axes)
+                ));
+                EXPECT_TRUE(allclose(
+                    evaluate(blockwise::stddev(a, block_shape, axes, keep_dims | with_policy(policy))),
+                    stddev(a, axes, keep_dims)
+                ));
+            }
+            auto res = blockwise::describe(a, block_shape, 0, with_policy(policy));
+            auto expected = describe(a, 0);
+            EXPECT_EQ(res.argmin, expected.argmin);
+            EXPECT_EQ(res.argmax, expected.argmax);
+            EXPECT_TRUE(allclose(res.variance, expected.variance));
+        }
+    }
+
+    TEST(xexecution, expression_cost)
+    {
+        xarray<double> a = {1., 2., 3.};
+        xarray<double> b = {4., 5., 6.};
+        using plus_cost = expression_cost<decltype(a + b)>;
+        using scalar_cost = expression_cost<decltype(a + 2.)>;
+        using exp_cost = expression_cost<decltype(exp(a) + b)>;
+        EXPECT_EQ(expression_cost<xarray<double>>::value, 1u);
+        EXPECT_EQ(plus_cost::value, 3u);
+        EXPECT_EQ(scalar_cost::value, 2u);
+        EXPECT_GT(exp_cost::value, plus_cost::value);
+        EXPECT_GT(expression_cost<decltype(a / b)>::value, plus_cost::value);
+    }
+
+    TEST(xexecution, cost_model)
+    {
+        parallel_cost_model previous = get_parallel_cost_model();
+        set_parallel_cost_model(parallel_cost_model{1000, 100});
+
+        EXPECT_FALSE(execution::par_threads.use_parallel(100, 3));
+        EXPECT_TRUE(execution::par_threads.use_parallel(100, 20));
+        EXPECT_FALSE(execution::seq.use_parallel(100000, 20));
+        EXPECT_TRUE(execution::par_threads.use_parallel(std::numeric_limits<std::size_t>::max(), 20));
+        EXPECT_EQ(execution::par_threads.grain_size(3), 34u);
+        EXPECT_EQ(execution::par_threads.grain_size(200), 1u);
+
+        set_parallel_cost_model(previous);
+        EXPECT_EQ(get_parallel_cost_model().min_work, previous.min_work);
+        EXPECT_EQ(get_parallel_cost_model().min_chunk_work, previous.min_chunk_work);
+    }
+
+    TEST(xexecution, calibrate)
+    {
+        parallel_cost_model previous = get_parallel_cost_model();
+        std::size_t nb_threads = get_num_threads();
+
+        set_num_threads(2);
+        parallel_cost_model model = calibrate_parallel_cost_model(execution::par_threads);
+        EXPECT_EQ(get_parallel_cost_model().min_work, model.min_work);
+        EXPECT_GT(model.min_work, 0u);
+        EXPECT_LT(model.min_work, std::numeric_limits<std::size_t>::max());
+        EXPECT_GE(model.min_chunk_work, 1u);
+
+        set_num_threads(1);
+        parallel_cost_model single_model = calibrate_parallel_cost_model(execution::par_threads);
+        EXPECT_EQ(single_model.min_work, std::numeric_limits<std::size_t>::max());
+        set_num_threads(nb_threads);
+
+        parallel_cost_model seq_model = calibrate_parallel_cost_model(execution::seq);
+        EXPECT_EQ(seq_model.min_work, std::numeric_limits<std::size_t>::max());
+        set_parallel_cost_model(previous);
+    }
+
+    TEST(xexecution, runtime_policy)
+    {
+        xarray<double> small = arange<double>(10.);
+        xarray<double> large = arange<double>(10000.);
+        auto choose = [](const xarray<double>& e)
+        {
+            return e.size() > 1000 ? execution::par : execution::seq;
+        };
+        EXPECT_EQ(choose(small), execution::seq);
+        EXPECT_EQ(choose(large), execution::par);
+
+        xarray<double> res;
+        res.assign(large + 1., choose(large));
+        EXPECT_EQ(res, xarray<double>(large + 1.));
+    }
+
+    TEST(xexecution, streaming)
+    {
+        EXPECT_TRUE(execution::streaming.streaming());
+        EXPECT_FALSE(execution::par.streaming());
+        EXPECT_EQ(execution::streaming.backend(), execution::default_policy.backend());
+        EXPECT_EQ(execution::par.with_streaming(), execution_policy(execution_backend::parallel, true));
+        EXPECT_NE(execution::par.with_streaming(), execution::par);
+        EXPECT_TRUE(execution::seq.with_streaming().use_streaming(1));
+
+        always_parallel guard;
+        xarray<double> a = arange<double>(1003.);
+        xarray<double> expected = a * 2. + 1.;
+        for (const auto& policy : policies)
+        {
+            xarray<double> res = zeros<double>({1003});
+            noalias(res).assign(a * 2. + 1., policy.with_streaming());
+            EXPECT_EQ(res, expected);
+
+            // destination with an offset in its buffer
+            xarray<double> big = zeros<double>({1010});
+            auto v = view(big, range(3, 1006));
+            v.assign(a * 2. + 1., policy.with_streaming());
+            EXPECT_EQ(v, expected);
+            EXPECT_EQ(big(2), 0.);
+            EXPECT_EQ(big(1006), 0.);
+
+            // value types without streaming stores
+            xarray<bool> b;
+            b.assign(a > 500., policy.with_streaming());
+            EXPECT_TRUE(b(501));
+            EXPECT_FALSE(b(500));
+        }
+    }
+
+    TEST(xexecution, first_touch)
+    {
+        always_parallel guard;
+        xtensor<double, 2> a = reshape_view(arange<double>(3000.), {60, 50});
+        xtensor<double, 2> expected = a;
+        for (const auto& policy : policies)
+        {
+            first_touch(a, policy);
+            EXPECT_EQ(a, expected);
+        }
+
+        auto b = xarray<int>::from_shape({20000});
+        first_touch(b.data(), b.size(), execution::par);
+        b.assign(arange<int>(20000), execution::par);
+        EXPECT_EQ(b(19999), 19999);
+
+        std::vector<char> empty;
+        first_touch(empty.data(), empty.size(), execution::par);
+    }
+}
@@ -83,4 +83,22 @@ namespace xt
             REQUIRE(expected(i) == doctest::Approx(abs(i)).epsilon(.0001));
         }
     }
+
+    TEST(xfft, fft_slices_par_threads)
+    {
+        size_t n = 16;
+        size_t dim = 9;
+        auto x = xt::linspace<float>(0, n - 1, n) * xt::ones<float>({dim, n});
+        xt::xarray<float> y = xt::sin(2 * xt::numeric_constants<float>::PI * x * 3 / n) + x / n;
+        auto expected = xt::fft::fft(y, -1, xt::seq);
+        xt::parallel_cost_model previous = xt::get_parallel_cost_model();
+        xt::set_parallel_cost_model(xt::parallel_cost_model{0, 1});
+        auto res = xt::fft::fft(y, -1, xt::execution::par_threads);
+        xt::set_parallel_cost_model(previous);
+        REQUIRE(expected.shape() == res.shape());
+        for (size_t i = 0; i < res.size(); i++)
+        {
+            REQUIRE(std::abs(expected.flat(i) - res.flat(i)) < 1e-5);
+        }
+    }
 }
@@ -876,6 +876,42 @@ namespace xt
         EXPECT_EQ(xt::average(v, w, {0, 1})(), m);
     }
 
+    TEST(xmath, variance)
+    {
+        // The large offset makes the naive sum of squares formula lose all precision
+        xt::xtensor<double, 2> v = 1e8 + xt::random::rand<double>({1000, 7});
+        xt::xtensor<double, 2, xt::layout_type::column_major> cv = v;
+        auto two_pass = [](const auto& e, const auto& axes, std::size_t ddof)
+        {
+            auto mv = xt::eval(xt::mean(e, axes, xt::keep_dims | xt::evaluation_strategy::immediate));
+            return xt::eval(xt::sum(xt::square(e - mv), axes) / double(e.size() / mv.size() - ddof));
+        };
+
+        std::vector<std::vector<std::size_t>> axes_list = {{0}, {1}, {0, 1}};
+        for (const auto& axes : axes_list)
+        {
+            auto expected = two_pass(v, axes, 0);
+            EXPECT_TRUE(xt::allclose(xt::variance(v, axes), expected));
+            EXPECT_TRUE(xt::allclose(xt::variance(v, axes, xt::evaluation_strategy::immediate), expected));
+            EXPECT_TRUE(xt::allclose(xt::variance(cv, axes, xt::evaluation_strategy::immediate), expected));
+            EXPECT_TRUE(xt::allclose(xt::variance(cv, axes), expected));
+            EXPECT_TRUE(xt::allclose(xt::variance(v, axes, 1), two_pass(v, axes, 1)));
+            EXPECT_TRUE(xt::allclose(xt::stddev(v, axes), xt::sqrt(expected)));
+            EXPECT_TRUE(xt::allclose(xt::variance(v, axes) * 2., 2. * expected));
+        }
+
+        std::vector<std::size_t> all_axes = {0, 1};
+        EXPECT_LT(std::abs(xt::variance(v)() - two_pass(v, all_axes, 0)()), 1e-6);
+        EXPECT_LT(std::abs(xt::variance(v, 1)() - two_pass(v, all_axes, 1)()), 1e-6);
+        EXPECT_LT(std::abs(xt::variance(xt::transpose(v))() - xt::variance(v)()), 1e-6);
+
+        xt::xtensor<int, 1> i = {1, 2, 3, 4};
+        EXPECT_EQ(xt::variance(i)(), 1.25);
+        EXPECT_EQ(xt::variance(i, {0}, 1)(), 5. / 3.);
+        xt::xtensor<float, 1> f = {1.f, 2.f, 3.f, 4.f};
+        EXPECT_EQ(xt::variance<float>(f)(), 1.25f);
+    }
+
     /************************
      * Linear interpolation *
      ************************/
@@ -7,6 +7,9 @@
  * The full license is in the file LICENSE, distributed with this software. *
  ****************************************************************************/
 
+#include <cmath>
+#include <numeric>
+
 #include "test_common_macros.hpp"
 
 #if (defined(__GNUC__) && !defined(__clang__))
@@ -21,7 +24,9 @@
 #include "xtensor/containers/xarray.hpp"
 #include "xtensor/containers/xtensor.hpp"
 #include "xtensor/core/xmath.hpp"
+#include "xtensor/generators/xrandom.hpp"
 #include "xtensor/views/xstrided_view.hpp"
+#include "xtensor/views/xview.hpp"
 
 #include "xtl/xtype_traits.hpp"
 
@@ -238,6 +243,85 @@ namespace xt
         EXPECT_TRUE(allclose(nanvar(nantest::aN, {1}, evaluation_strategy::immediate), eaN1));
     }
 
+    TEST(xnanfunctions, long_reductions)
+    {
+        // long enough for the vectorized loops, with NaN values spread in every lane
+        xtensor<double, 2> a = xt::random::rand<double>({7, 1001});
+        for (std::size_t i = 0; i < a.size(); i += 3)
+        {
+            a.flat(i * 5 % a.size()) = nanv;
+        }
+        xtensor<float, 2> af = xt::cast<float>(a);
+        xtensor<double, 2> ap = 1. + a / 1000.;
+
+        double sum = 0.;
+        double prod = 1.;
+        double min = d_max;
+        double max = -d_max;
+        std::size_t count = 0;
+        for (auto v : a)
+        {
+            if (!std::isnan(v))
+            {
+                sum += v;
+                prod *= 1. + v / 1000.;
+                min = (std::min)(min, v);
+                max = (std::max)(max, v);
+                ++count;
+            }
+        }
+        double mean = sum / static_cast<double>(count);
+        double var = 0.;
+        for (auto v : a)
+        {
+            var += std::isnan(v) ? 0. : (v - mean) * (v - mean);
+        }
+        var /= static_cast<double>(count);
+
+        EXPECT_DOUBLE_EQ(nansum(a)(), sum);
+        EXPECT_DOUBLE_EQ(nansum(a, evaluation_strategy::immediate)(), sum);
+        EXPECT_DOUBLE_EQ(nanprod(ap)(), prod);
+        EXPECT_EQ(nanmin(a)(), min);
+        EXPECT_EQ(nanmax(a, evaluation_strategy::immediate)(), max);
+        EXPECT_EQ(nanmin(af)(), static_cast<float>(min));
+        EXPECT_EQ(nanmax(af, evaluation_strategy::immediate)(), static_cast<float>(max));
+        EXPECT_DOUBLE_EQ(nanmean(a)(), mean);
+        EXPECT_DOUBLE_EQ(nanmean(a, evaluation_strategy::immediate)(), mean);
+        EXPECT_TRUE(std::abs(nanmean<float>(af)() - mean) < 1e-5);
+        EXPECT_DOUBLE_EQ(nanvar(a)(), var);
+        EXPECT_DOUBLE_EQ(nanvar(a, evaluation_strategy::immediate)(), var);
+        EXPECT_TRUE(std::abs(nanvar<float>(af)() - var) < 1e-5);
+        EXPECT_DOUBLE_EQ(nanvar<float>(a)(), var);
+
+        xtensor<double, 1> row_sum = nansum(a, {1});
+        xtensor<double, 1> row_mean = nanmean(a, {1}, evaluation_strategy::immediate);
+        xtensor<double, 1> row_var = nanvar(a, {1});
+        xtensor<double, 1> row_min = nanmin(a, {1}, evaluation_strategy::immediate);
+        for (std::size_t i = 0; i < a.shape()[0]; ++i)
+        {
+            auto row = xt::filter(xt::view(a, i), !xt::isnan(xt::view(a, i)));
+            xarray<double> r = row;
+            double row_m = std::accumulate(r.begin(), r.end(), 0.) / static_cast<double>(r.size());
+            EXPECT_DOUBLE_EQ(row_sum(i), std::accumulate(r.begin(), r.end(), 0.));
+            EXPECT_DOUBLE_EQ(row_mean(i), row_m);
+            EXPECT_DOUBLE_EQ(row_var(i), xt::mean(xt::square(r - row_m))());
+            EXPECT_EQ(row_min(i), *std::min_element(r.begin(), r.end()));
+        }
+
+        xtensor<double, 1> col_mean = nanmean(a, {0});
+        xtensor<double, 1> col_var = nanvar(a, {0}, evaluation_strategy::immediate);
+        xarray<double> all_nan = {nanv, nanv, nanv, nanv, nanv, nanv, nanv, nanv, nanv, nanv};
+        xtensor<double, 1> col_sum = nansum(a, {0});
+        xtensor<double, 1> col_count = count_nonnan(a, {0});
+        auto col_dev = a - xt::view(col_mean, xt::newaxis(), xt::all());
+        xtensor<double, 1> col_sq = nanmean(xt::square(col_dev), {0});
+        EXPECT_TRUE(xt::allclose(col_mean, col_sum / col_count));
+        EXPECT_TRUE(xt::allclose(col_var, col_sq));
+        EXPECT_TRUE(std::isnan(nanmin(all_nan)()));
+        EXPECT_EQ(nansum(all_nan)(), 0.);
+        EXPECT_TRUE(std::isnan(nanmean(all_nan)()));
+    }
+
     using shape_type = dynamic_shape<size_t>;
 
     /*******************
@@ -356,5 +440,12 @@ namespace xt
         CHECK_TEMPLATED_RESULT_TYPE_FOR_ALL(adouble, float, double, double, double);
         CHECK_TEMPLATED_RESULT_TYPE_FOR_ALL(adouble, double, double, double, double);
         CHECK_TEMPLATED_RESULT_TYPE_FOR_ALL(adouble, long double, long double, long double, long double);
+
+        // Same result types for the single pass variance of floating point result types
+        CHECK_RESULT_TYPE(nanvar(afloat), double);
+        CHECK_RESULT_TYPE(nanvar<float>(adouble), double);
+        CHECK_RESULT_TYPE(nanstd<float>(adouble), double);
+        CHECK_RESULT_TYPE(nanvar<float>(aint), float);
+        CHECK_RESULT_TYPE(nanvar<double>(xarray<long double>(shape)), long double);
     }
 }
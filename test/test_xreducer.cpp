@@ -701,6 +701,89 @@ namespace xt
         EXPECT_EQ(minmax(input)(), (A{-1.0, 1.0}));
     }
 
+    TEST(xreducer, describe)
+    {
+        // Few distinct values, so that the extrema are repeated and their first positions returned
+        xtensor<int, 2> a = xt::random::randint<int>({600, 9}, -50, 50);
+        xtensor<int, 2, layout_type::column_major> ca = a;
+        auto check = [](const auto& res, const auto& e, std::size_t axis)
+        {
+            EXPECT_TRUE(all(equal(res.count, xt::ones<std::size_t>(res.sum.shape()) * e.shape()[axis])));
+            EXPECT_EQ(res.sum, xt::sum<double>(e, {axis}));
+            EXPECT_TRUE(allclose(res.mean, xt::mean<double>(e, {axis})));
+            EXPECT_TRUE(allclose(res.variance, xt::variance<double>(e, {axis})));
+            EXPECT_EQ(res.min, xt::amin(e, {axis}));
+            EXPECT_EQ(res.max, xt::amax(e, {axis}));
+            for (std::size_t i = 0; i < res.argmin.size(); ++i)
+            {
+                xstrided_slice_vector sv = {all(), all()};
+                sv[1 - axis] = static_cast<std::ptrdiff_t>(i);
+                auto line = strided_view(e, sv);
+                std::vector<int> values(line.begin(), line.end());
+                auto first_min = std::min_element(values.begin(), values.end()) - values.begin();
+                auto first_max = std::max_element(values.begin(), values.end()) - values.begin();
+                EXPECT_EQ(res.argmin(i), static_cast<std::size_t>(first_min));
+                EXPECT_EQ(res.argmax(i), static_cast<std::size_t>(first_max));
+            }
+        };
+
+        for (std::size_t axis : {0u, 1u})
+        {
+            check(describe(a, std::ptrdiff_t(axis)), a, axis);
+            check(describe(ca, std::ptrdiff_t(axis)), ca, axis);
+            check(describe(a, std::ptrdiff_t(axis), evaluation_strategy::immediate), a, axis);
+            check(describe(ca, std::ptrdiff_t(axis), evaluation_strategy::immediate), ca, axis);
+        }
+        check(describe(a, -1), a, 1);
+
+        // The flattened positions are row major whatever the layout
+        xtensor<int, 1> flat = flatten(a);
+        for (const auto& res : {describe(a), describe(ca), describe(ca, evaluation_strategy::immediate)})
+        {
+            EXPECT_EQ(res.count(), flat.size());
+            EXPECT_EQ(res.sum(), xt::sum<double>(a)());
+            EXPECT_EQ(res.min(), amin(a)());
+            EXPECT_EQ(res.max(), amax(a)());
+            auto first_min = std::min_element(flat.begin(), flat.end()) - flat.begin();
+            auto first_max = std::max_element(flat.begin(), flat.end()) - flat.begin();
+            EXPECT_EQ(res.argmin(), static_cast<std::size_t>(first_min));
+            EXPECT_EQ(res.argmax(), static_cast<std::size_t>(first_max));
+        }
+
+        xtensor<float, 1> f = {2.f, 4.f, 1.f, 1.f};
+        auto fres = describe(f);
+        EXPECT_TRUE((std::is_same<decltype(fres.variance), xarray<float>>::value));
+        EXPECT_EQ(fres.mean(), 2.f);
+        EXPECT_EQ(fres.variance(), 1.5f);
+        EXPECT_EQ(fres.argmin(), 2u);
+        EXPECT_EQ(fres.argmax(), 1u);
+
+        // A leading NaN is kept, as by the element-wise reduction of n + 0.; a NaN
+        // elsewhere, here at the beginning of the second block of values, is skipped
+        const double nan = std::numeric_limits<double>::quiet_NaN();
+        xtensor<double, 2> n = xt::random::rand<double>({40, 30});
+        n.flat(512) = nan;
+        n.flat(600) = -1.;
+        n.flat(700) = 2.;
+        xtensor<double, 2, layout_type::column_major> cn = n;
+        for (const auto& res : {describe(n), describe(cn), describe(n + 0.)})
+        {
+            EXPECT_EQ(res.min(), -1.);
+            EXPECT_EQ(res.max(), 2.);
+            EXPECT_EQ(res.argmin(), 600u);
+            EXPECT_EQ(res.argmax(), 700u);
+        }
+        n.flat(0) = nan;
+        cn = n;
+        for (const auto& res : {describe(n), describe(cn), describe(n + 0.)})
+        {
+            EXPECT_TRUE(std::isnan(res.min()));
+            EXPECT_TRUE(std::isnan(res.max()));
+            EXPECT_EQ(res.argmin(), 0u);
+            EXPECT_EQ(res.argmax(), 0u);
+        }
+    }
+
     TEST(xreducer, immediate)
     {
         xarray<double> a = xt::arange(27);
@@ -770,6 +853,91 @@ namespace xt
         EXPECT_EQ(sum(ct2, {1, 3}), sum(ct2, {1, 3}, evaluation_strategy::immediate));
     }
 
+    TEST(xreducer, linear_reduce)
+    {
+        xarray<double> a = arange<double>(1003.) * 0.5;
+        double expected = std::accumulate(a.cbegin(), a.cend(), 0.);
+        EXPECT_EQ(sum(a)(), expected);
+        EXPECT_EQ(sum(a, evaluation_strategy::immediate)(), expected);
+        EXPECT_EQ(sum(a + a)(), 2. * expected);
+        EXPECT_EQ(sum(view(a, range(1, 1003, 2)))(), expected - sum(view(a, range(0, 1003, 2)))());
+        EXPECT_EQ(sum(a, initial(1.))(), expected + 1.);
+
+        a(0) = 1000.;
+        a(1002) = -4.;
+        EXPECT_EQ(amax(a)(), 1000.);
+        EXPECT_EQ(amin(a)(), -4.);
+        EXPECT_EQ(amax(a, evaluation_strategy::immediate)(), 1000.);
+        EXPECT_EQ(amin(a, evaluation_strategy::immediate)(), -4.);
+
+        xarray<double> p = ones<double>({1001});
+        p(3) = 2.;
+        p(1000) = 0.5;
+        p(517) = 4.;
+        EXPECT_EQ(prod(p)(), 4.);
+        EXPECT_EQ(prod(p, evaluation_strategy::immediate)(), 4.);
+
+        xarray<int> i = arange<int>(1001);
+        EXPECT_EQ(sum(i)(), 500500);
+        EXPECT_EQ(sum<double>(i)(), 500500.);
+
+        xarray<bool> b = zeros<bool>({37});
+        auto any_functor = make_xreducer_functor(detail::logical_or(), const_value<bool>(false));
+        EXPECT_FALSE(reduce(any_functor, b)());
+        b(36) = true;
+        EXPECT_TRUE(reduce(any_functor, b)());
+
+        // reduction over trailing contiguous axes
+        xtensor<double, 3> t = reshape_view(arange<double>(3. * 4. * 101.), {3, 4, 101});
+        xtensor<double, 3, layout_type::column_major> ct = t;
+        EXPECT_EQ(sum(t, {2}, evaluation_strategy::immediate), sum(t, {2}));
+        EXPECT_EQ(sum(t, {1, 2}, evaluation_strategy::immediate), sum(t, {1, 2}));
+        EXPECT_EQ(amax(t, {1, 2}, evaluation_strategy::immediate), amax(t, {1, 2}));
+        EXPECT_EQ(sum(ct, {0, 1}, evaluation_strategy::immediate), sum(t, {0, 1}));
+        EXPECT_EQ(sum(ct)(), sum(t)());
+    }
+
+    TEST(xreducer, compensated_sum)
+    {
+        xtensor<float, 3> a = xt::random::rand<float>({3, 1 << 14, 5});
+        xtensor<float, 3, layout_type::column_major> ca = a;
+        xtensor<double, 3> da = a;
+
+        auto max_error = [](const auto& res, const auto& expected)
+        {
+            return amax(abs(res - expected) / expected)();
+        };
+
+        std::vector<std::vector<std::size_t>> axes_list = {{0}, {1}, {2}, {0, 1}, {1, 2}, {0, 2}, {0, 1, 2}};
+        for (const auto& axes : axes_list)
+        {
+            xarray<double> expected = sum(da, axes, evaluation_strategy::immediate);
+            xarray<float> pi = sum(a, axes, evaluation_strategy::immediate | pairwise);
+            EXPECT_LT(max_error(pi, expected), 1e-6);
+            xarray<float> pl = sum(a, axes, pairwise);
+            EXPECT_LT(max_error(pl, expected), 1e-6);
+            xarray<float> ki = sum(a, axes, evaluation_strategy::immediate | kahan);
+            EXPECT_LT(max_error(ki, expected), 1e-6);
+            xarray<float> kl = sum(a, axes, kahan);
+            EXPECT_LT(max_error(kl, expected), 1e-6);
+            xarray<float> cpi = sum(ca, axes, evaluation_strategy::immediate | pairwise);
+            EXPECT_LT(max_error(cpi, expected), 1e-6);
+            xarray<float> cki = sum(ca, axes, evaluation_strategy::immediate | kahan);
+            EXPECT_LT(max_error(cki, expected), 1e-6);
+        }
+
+        double expected = sum(da)();
+        EXPECT_LT(std::abs(sum(transpose(a), pairwise)() - expected) / expected, 1e-6);
+        EXPECT_LT(std::abs(sum(a, kahan | initial(1.f))() - expected - 1.) / expected, 1e-6);
+        double full_mean = expected / double(a.size());
+        EXPECT_LT(std::abs(mean(a, kahan)() - full_mean) / full_mean, 1e-6);
+
+        xarray<double> expected_mean = mean(da, {1}, keep_dims | evaluation_strategy::immediate);
+        xarray<float> m = mean(a, {1}, keep_dims | pairwise | evaluation_strategy::immediate);
+        EXPECT_EQ(m.shape(), expected_mean.shape());
+        EXPECT_LT(max_error(m, expected_mean), 1e-6);
+    }
+
     TEST(xreducer, chaining_reducers)
     {
         xt::xarray<double> a = {{1., 2.}, {3., 4.}};
@@ -7,6 +7,9 @@
  * The full license is in the file LICENSE, distributed with this software. *
  ****************************************************************************/
 
+#include <algorithm>
+#include <numeric>
+
 #include "xtensor/containers/xadapt.hpp"
 #include "xtensor/containers/xarray.hpp"
 #include "xtensor/containers/xfixed.hpp"
@@ -15,8 +18,10 @@
 #include "xtensor/generators/xrandom.hpp"
 #include "xtensor/io/xinfo.hpp"
 #include "xtensor/io/xio.hpp"
+#include "xtensor/misc/xmanipulation.hpp"
 #include "xtensor/misc/xsort.hpp"
 #include "xtensor/views/xslice.hpp"
+#include "xtensor/views/xstrided_view.hpp"
 #include "xtensor/views/xview.hpp"
 
 #include "test_common_macros.hpp"
@@ -280,6 +285,189 @@ namespace xt
         EXPECT_EQ(1, argmax(d)(0));
     }
 
+    TEST(xsort, argmin_argmax_long)
+    {
+        // int8_t counts at most 127 iterations of a block of SIMD lanes exactly
+        xarray<int8_t> a = xt::cast<int8_t>(xt::random::randint<int>({7, 3001}, -100, 100));
+        a(2, 2999) = -128;
+        a(4, 17) = -128;
+        a(5, 1000) = 127;
+        a(5, 2000) = 127;
+        a(6, 3000) = 127;
+        a(1, 8) = 127;
+        for (std::ptrdiff_t i = 0; i < 7; ++i)
+        {
+            auto row = xt::row(a, i);
+            EXPECT_EQ(std::size_t(std::min_element(row.begin(), row.end()) - row.begin()), argmin(a, 1)(i));
+            EXPECT_EQ(std::size_t(std::max_element(row.begin(), row.end()) - row.begin()), argmax(a, 1)(i));
+        }
+        EXPECT_EQ(std::size_t(3001 + 8), argmax(a)());
+        EXPECT_EQ(std::size_t(3001 * 2 + 2999), argmin(a)());
+
+        // The first element wins when it is NaN, the other NaN values are ignored
+        xtensor<double, 1> b = xt::arange<double>(1000.);
+        b(900) = -1.;
+        b(950) = -1.;
+        b(10) = std::numeric_limits<double>::quiet_NaN();
+        EXPECT_EQ(std::size_t(900), argmin(b)());
+        EXPECT_EQ(std::size_t(999), argmax(b)());
+        b(0) = std::numeric_limits<double>::quiet_NaN();
+        EXPECT_EQ(std::size_t(0), argmin(b)());
+        EXPECT_EQ(std::size_t(0), argmax(b)());
+    }
+
+    template <class T>
+    void check_radix_sort(const xarray<T>& a)
+    {
+        for (std::ptrdiff_t axis = 0; axis < 2; ++axis)
+        {
+            EXPECT_EQ(sort(a, axis, sorting_method::radix), sort(a, axis));
+            EXPECT_EQ(argsort(a, axis, sorting_method::radix), argsort(a, axis, sorting_method::stable));
+        }
+        EXPECT_EQ(sort(a, xnone(), sorting_method::radix), sort(a, xnone()));
+        EXPECT_EQ(argsort(a, xnone(), sorting_method::radix), argsort(a, xnone(), sorting_method::stable));
+    }
+
+    TEST(xsort, radix)
+    {
+        check_radix_sort<int8_t>(xt::cast<int8_t>(xt::random::randint<int>({5, 301}, -128, 128)));
+        check_radix_sort<uint16_t>(xt::cast<uint16_t>(xt::random::randint<int>({5, 301}, 0, 200)));
+        check_radix_sort<int>(xt::random::randint<int>({5, 301}, -1000000, 1000000));
+        const int64_t large = int64_t(1) << 60;
+        check_radix_sort<int64_t>(xt::random::randint<int64_t>({5, 301}, -large, large));
+        check_radix_sort<uint64_t>(xt::random::randint<uint64_t>({5, 301}, 0, uint64_t(1) << 63));
+        check_radix_sort<float>(xt::cast<float>(xt::random::randn<double>({5, 301})));
+        check_radix_sort<long double>(xt::cast<long double>(xt::random::randn<double>({5, 301})));
+
+        // Few distinct values, so that the order of equivalent elements is checked
+        xarray<double> d = xt::cast<double>(xt::random::randint<int>({5, 301}, -5, 5)) * 1.5;
+        d(0, 3) = std::numeric_limits<double>::infinity();
+        d(2, 7) = -std::numeric_limits<double>::infinity();
+        d(4, 0) = std::numeric_limits<double>::lowest();
+        check_radix_sort<double>(d);
+
+        xarray<double> zeros = {0., -0., 1., -1.};
+        auto sorted_zeros = sort(zeros, xnone(), sorting_method::radix);
+        EXPECT_TRUE(std::signbit(sorted_zeros(1)));
+        EXPECT_FALSE(std::signbit(sorted_zeros(2)));
+        EXPECT_EQ(argsort(zeros, 0, sorting_method::radix), xarray<std::size_t>({3, 1, 0, 2}));
+    }
+
+    template <class E>
+    void check_axis_sorts(const E& a)
+    {
+        using value_type = typename E::value_type;
+        for (std::size_t axis = 0; axis < 3; ++axis)
+        {
+            CAPTURE(axis);
+            const auto sax = static_cast<std::ptrdiff_t>(axis);
+            // References computed along the last axis of a row-major copy
+            xarray<value_type> swapped = swapaxes(a, sax, 2);
+            xarray<value_type> expected = swapaxes(sort(swapped, 2), sax, 2);
+            xarray<std::size_t> expected_idx = swapaxes(argsort(swapped, 2, sorting_method::stable), sax, 2);
+
+            EXPECT_EQ(sort(a, sax), expected);
+            EXPECT_EQ(sort(a, sax, sorting_method::radix), expected);
+            EXPECT_EQ(argsort(a, sax, sorting_method::stable), expected_idx);
+            EXPECT_EQ(argsort(a, sax, sorting_method::radix), expected_idx);
+            EXPECT_EQ(argsort(view(a, all(), all(), all()), sax, sorting_method::stable), expected_idx);
+
+            const std::size_t kth = a.shape()[axis] / 2;
+            const auto part = partition(a, kth, sax);
+            const auto argpart = argpartition(a, kth, sax);
+            xarray<value_type> gathered = xarray<value_type>::from_shape(a.shape());
+            bool kth_ok = true;
+            std::array<std::size_t, 3> idx;
+            for (idx[0] = 0; idx[0] < a.shape()[0]; ++idx[0])
+            {
+                for (idx[1] = 0; idx[1] < a.shape()[1]; ++idx[1])
+                {
+                    for (idx[2] = 0; idx[2] < a.shape()[2]; ++idx[2])
+                    {
+                        std::array<std::size_t, 3> src = idx;
+                        src[axis] = argpart[idx];
+                        gathered[idx] = a[src];
+                        if (idx[axis] == kth)
+                        {
+                            kth_ok = kth_ok && part[idx] == expected[idx] && gathered[idx] == expected[idx];
+                        }
+                    }
+                }
+            }
+            EXPECT_TRUE(kth_ok);
+            EXPECT_EQ(sort(part, sax), expected);
+            EXPECT_EQ(sort(gathered, sax), expected);
+        }
+    }
+
+    TEST(xsort, axis_sorts)
+    {
+        // The lanes along non-leading axes are sorted by blocks, the last of which is partial here
+        xarray<int> a = reshape_view(arange<int>(5 * 300 * 40) * 7919 % 101, {5, 300, 40});
+        check_axis_sorts(a);
+        check_axis_sorts(xarray<int, layout_type::column_major>(a));
+        xarray<double> b = xt::random::randn<double>({1, 37, 3});
+        check_axis_sorts(b);
+        check_axis_sorts(xtensor<double, 3, layout_type::column_major>(b));
+    }
+
+    template <class T>
+    void check_network_sorts(std::size_t n, std::size_t n_lanes)
+    {
+        CAPTURE(n);
+        // Few distinct values, so that the order of equivalent elements is checked
+        xarray<T> lanes = xt::cast<T>(xt::random::randint<int>({n_lanes, n}, -20, 20));
+        xarray<T> expected = lanes;
+        xarray<std::size_t> expected_idx = xarray<std::size_t>::from_shape(lanes.shape());
+        for (std::size_t i = 0; i < n_lanes; ++i)
+        {
+            auto row = view(expected, i, all());
+            std::sort(row.begin(), row.end());
+            auto idx = view(expected_idx, i, all());
+            std::iota(idx.begin(), idx.end(), std::size_t(0));
+            std::stable_sort(
+                idx.begin(),
+                idx.end(),
+                [&lanes, i](std::size_t j, std::size_t k)
+                {
+                    return lanes(i, j) < lanes(i, k);
+                }
+            );
+        }
+        EXPECT_EQ(sort(lanes, 1), expected);
+        EXPECT_EQ(argsort(lanes, 1), expected_idx);
+        EXPECT_EQ(argsort(lanes, 1, sorting_method::stable), expected_idx);
+
+        xarray<T> columns = transpose(lanes);
+        xarray<T, layout_type::column_major> ccolumns = columns;
+        EXPECT_EQ(sort(columns, 0), transpose(expected));
+        EXPECT_EQ(sort(ccolumns, 0), transpose(expected));
+        EXPECT_EQ(argsort(columns, 0, sorting_method::stable), transpose(expected_idx));
+        EXPECT_EQ(argsort(ccolumns, 0, sorting_method::stable), transpose(expected_idx));
+    }
+
+    TEST(xsort, sorting_network)
+    {
+        for (std::size_t n : {2, 3, 8, 13, 33, 64})
+        {
+            check_network_sorts<int>(n, 300);
+            check_network_sorts<double>(n, 300);
+            check_network_sorts<uint8_t>(n, 40);
+            check_network_sorts<int64_t>(n, 40);
+            check_network_sorts<long double>(n, 40);
+        }
+
+        // NaN values are moved around but not lost
+        xarray<double> a = xt::random::randn<double>({100, 10});
+        a(3, 4) = std::numeric_limits<double>::quiet_NaN();
+        a(50, 0) = std::numeric_limits<double>::quiet_NaN();
+        auto s = sort(a, 1);
+        EXPECT_EQ(sum(xt::isnan(s))(), std::size_t(2));
+        EXPECT_DOUBLE_EQ(nansum(s)(), nansum(a)());
+        auto idx = argsort(a, 1);
+        EXPECT_EQ(sort(idx, 1), sort(argsort(a, 1, sorting_method::stable), 1));
+    }
+
     TEST(xsort, sort_large_prob)
     {
         for (std::size_t i = 0; i < 20; ++i)
@@ -550,6 +738,59 @@ namespace xt
         }
     }
 
+    template <class E>
+    void check_axis_quantiles(const E& a)
+    {
+        const xtensor<double, 1> probas = {0., .5, .9, .99, .999, 1.};
+        for (std::size_t axis = 0; axis < a.dimension(); ++axis)
+        {
+            CAPTURE(axis);
+            const auto sax = static_cast<std::ptrdiff_t>(axis);
+            const std::size_t n = a.shape()[axis];
+            const xarray<double> sorted = sort(a, sax);
+            const auto q = xt::quantile(a, probas, sax);
+            ASSERT_EQ(q.dimension(), a.dimension());
+            EXPECT_EQ(q.shape()[0], probas.size());
+            for (std::size_t p = 0; p < probas.size(); ++p)
+            {
+                const double h = static_cast<double>(n - 1) * probas[p];
+                const std::size_t j = static_cast<std::size_t>(std::floor(h));
+                const double g = h - static_cast<double>(j);
+                xstrided_slice_vector lower(a.dimension(), all());
+                xstrided_slice_vector upper(a.dimension(), all());
+                lower[axis] = static_cast<std::ptrdiff_t>(j);
+                upper[axis] = static_cast<std::ptrdiff_t>(std::min(j + 1, n - 1));
+                const xarray<double> expected = (1. - g) * strided_view(sorted, lower)
+                                                + g * strided_view(sorted, upper);
+                EXPECT_TRUE(allclose(view(q, p), expected));
+            }
+
+            xstrided_slice_vector middle(a.dimension(), all());
+            middle[axis] = static_cast<std::ptrdiff_t>((n - 1) / 2);
+            const auto med = median(a, sax);
+            if (n % 2 == 1)
+            {
+                EXPECT_TRUE(allclose(med, strided_view(sorted, middle)));
+            }
+            else
+            {
+                xstrided_slice_vector next = middle;
+                next[axis] = static_cast<std::ptrdiff_t>(n / 2);
+                const xarray<double> expected = (strided_view(sorted, middle) + strided_view(sorted, next))
+                                                / 2.;
+                EXPECT_TRUE(allclose(med, expected));
+            }
+        }
+    }
+
+    TEST(xsort, axis_quantiles)
+    {
+        xarray<double> a = xt::random::randn<double>({7, 50, 9});
+        check_axis_quantiles(a);
+        check_axis_quantiles(xarray<double, layout_type::column_major>(a));
+        check_axis_quantiles(xtensor<int, 2>(xt::random::randint<int>({40, 6}, -5, 5)));
+    }
+
     TEST(xsort, median)
     {
         xt::xtensor<float, 2> a = {{3, 4, 2, 1}, {1, 1, 3, 2}, {9, 9, 9, 9}, {12, 12, 12, 12}, {5, 5, 5, 5}};
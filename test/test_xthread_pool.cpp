@@ -0,0 +1,151 @@
+/***************************************************************************
+ * Copyright (c) Johan Mabille, Sylvain Corlay and Wolf Vollprecht          *
+ * Copyright (c) QuantStack                                                 *
+ *                                                                          *
+ * Distributed under the terms of the BSD 3-Clause License.                 *
+ *                                                                          *
+ * The full license is in the file LICENSE, distributed with this software. *
+ ****************************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "xtensor/containers/xarray.hpp"
+#include "xtensor/core/xexecution.hpp"
+#include "xtensor/generators/xbuilder.hpp"
+#include "xtensor/utils/xthread_pool.hpp"
+
+#include "test_common_macros.hpp"
+
+namespace xt
+{
+    TEST(xthread_pool, size)
+    {
+        thread_pool pool(3);
+        EXPECT_EQ(pool.size(), 3u);
+        pool.resize(5);
+        EXPECT_EQ(pool.size(), 5u);
+        pool.resize(0);
+        EXPECT_GE(pool.size(), 1u);
+    }
+
+    TEST(xthread_pool, parallel_for)
+    {
+        thread_pool pool(4);
+        for (std::size_t n : {std::size_t(1), std::size_t(7), std::size_t(1000)})
+        {
+            std::vector<int> visited(n + 3, 0);
+            pool.parallel_for(
+                std::size_t(3),
+                visited.size(),
+                [&visited](std::size_t first, std::size_t last)
+                {
+                    for (std::size_t i = first; i < last; ++i)
+                    {
+                        ++visited[i];
+                    }
+                }
+            );
+            EXPECT_EQ(std::accumulate(visited.cbegin(), visited.cbegin() + 3, 0), 0);
+            EXPECT_EQ(std::accumulate(visited.cbegin() + 3, visited.cend(), 0), static_cast<int>(n));
+            EXPECT_EQ(*std::max_element(visited.cbegin(), visited.cend()), 1);
+        }
+    }
+
+    TEST(xthread_pool, unbalanced)
+    {
+        thread_pool pool(4);
+        std::atomic<std::size_t> sum(0);
+        pool.parallel_for(
+            std::size_t(0),
+            std::size_t(64),
+            [&sum](std::size_t first, std::size_t last)
+            {
+                for (std::size_t i = first; i < last; ++i)
+                {
+                    // the first chunks are much more expensive than the last ones
+                    std::size_t local = 0;
+                    for (std::size_t j = 0; j < (64 - i) * 1000; ++j)
+                    {
+                        local += j % 3;
+                    }
+                    sum += local > 0 ? i : 0;
+                }
+            }
+        );
+        EXPECT_EQ(sum.load(), std::size_t(64 * 63 / 2));
+    }
+
+    TEST(xthread_pool, nested)
+    {
+        thread_pool pool(3);
+        std::vector<int> visited(100, 0);
+        pool.parallel_for(
+            std::size_t(0),
+            std::size_t(10),
+            [&pool, &visited](std::size_t first, std::size_t last)
+            {
+                for (std::size_t i = first; i < last; ++i)
+                {
+                    pool.parallel_for(
+                        i * 10,
+                        (i + 1) * 10,
+                        [&visited](std::size_t f, std::size_t l)
+                        {
+                            for (std::size_t k = f; k < l; ++k)
+                            {
+                                ++visited[k];
+                            }
+                        }
+                    );
+                }
+            }
+        );
+        EXPECT_EQ(std::accumulate(visited.cbegin(), visited.cend(), 0), 100);
+    }
+
+#if !defined(XTENSOR_DISABLE_EXCEPTIONS)
+    TEST(xthread_pool, exception)
+    {
+        thread_pool pool(4);
+        auto throwing = [](std::size_t first, std::size_t last)
+        {
+            if (first <= 50 && 50 < last)
+            {
+                throw std::runtime_error("chunk failure");
+            }
+        };
+        XT_EXPECT_THROW(pool.parallel_for(std::size_t(0), std::size_t(100), throwing), std::runtime_error);
+
+        // The pool is still usable after an exception
+        std::atomic<std::size_t> count(0);
+        pool.parallel_for(
+            std::size_t(0),
+            std::size_t(100),
+            [&count](std::size_t first, std::size_t last)
+            {
+                count += last - first;
+            }
+        );
+        EXPECT_EQ(count.load(), std::size_t(100));
+    }
+#endif
+
+    TEST(xthread_pool, set_num_threads)
+    {
+        std::size_t initial = get_num_threads();
+        set_num_threads(3);
+        EXPECT_EQ(get_num_threads(), 3u);
+
+        xarray<double> a = arange<double>(10000.);
+        xarray<double> res;
+        res.assign(a * 2. + 1., execution::par_threads);
+        EXPECT_EQ(res, xarray<double>(a * 2. + 1.));
+
+        set_num_threads(initial);
+        EXPECT_EQ(get_num_threads(), initial);
+    }
+}